@@ -0,0 +1,67 @@
+#include <atomic>   // atomic
+#include <cstddef>  // size_t, max_align_t
+#include <cstdlib>  // malloc, free
+#include <new>      // bad_alloc
+
+#include "bench.hpp"
+
+// Replaces the global operator new and delete to count the allocated bytes, see the bench::allocatedBytes() and
+// bench::peakAllocatedBytes().
+
+namespace
+{
+
+std::atomic<size_t> allocated(0);
+std::atomic<size_t> peak(0);
+
+// The size of the allocation is stored before the returned memory.
+constexpr size_t headerSize = alignof(std::max_align_t);
+
+// The bytes that the common malloc implementations use for the allocation: a 8 bytes header,
+// rounded up to 16 bytes, at least 32 bytes.
+size_t chunkSize(size_t size)
+{
+    size_t chunk = (size + 8 + 15) / 16 * 16;
+    return chunk < 32 ? 32 : chunk;
+}
+
+} // namespace
+
+size_t bench::allocatedBytes() { return allocated.load(std::memory_order_relaxed); }
+
+size_t bench::peakAllocatedBytes() { return peak.load(std::memory_order_relaxed); }
+
+void bench::resetPeakAllocatedBytes()
+{
+    peak.store(allocated.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+    void* ptr = std::malloc(size + headerSize);
+    if (!ptr)
+        throw std::bad_alloc();
+    *static_cast<size_t*>(ptr) = size;
+    size_t current = allocated.fetch_add(chunkSize(size), std::memory_order_relaxed) + chunkSize(size);
+    size_t highest = peak.load(std::memory_order_relaxed);
+    while (current > highest && !peak.compare_exchange_weak(highest, current, std::memory_order_relaxed))
+        ;
+    return static_cast<char*>(ptr) + headerSize;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+    void* base = static_cast<char*>(ptr) - headerSize;
+    allocated.fetch_sub(chunkSize(*static_cast<size_t*>(base)), std::memory_order_relaxed);
+    std::free(base);
+}
+
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
@@ -0,0 +1,47 @@
+#include <cstddef>    // size_t
+#include <fstream>    // ofstream
+#include <memory>     // unique_ptr
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Write many `Translations file`s by truncating them in place (as before) versus replacing them atomically
+// (see the easytr::detail::AtomicFile), committed one by one or together like the updateTranslationsFiles().
+BENCHMARK(atomicWrite)
+{
+    const size_t fileCount = 50;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench" / "atomic";
+    std::filesystem::create_directories(dir);
+
+    std::string content = bench::makeTranslations(200).toJson();
+    std::vector<std::string> filenames;
+    for (size_t i = 0; i < fileCount; ++i)
+        filenames.push_back((dir / ("file" + std::to_string(i) + ".json")).string());
+
+    bench::measure("truncate and write in place", fileCount, 5, [&]() {
+        for (const auto& filename : filenames)
+        {
+            std::ofstream ofs(filename, std::ios::binary);
+            ofs << content;
+        }
+    });
+
+    bench::measure("atomic write, committed one by one", fileCount, 5, [&]() {
+        for (const auto& filename : filenames)
+            easytr::detail::writeFileAtomically(filename, content);
+    });
+
+    bench::measure("atomic write, committed together", fileCount, 5, [&]() {
+        std::vector<std::unique_ptr<easytr::detail::AtomicFile>> files;
+        std::vector<easytr::detail::AtomicFile*> pending;
+        for (const auto& filename : filenames)
+        {
+            files.emplace_back(new easytr::detail::AtomicFile(filename));
+            files.back()->write(content);
+            pending.push_back(files.back().get());
+        }
+        easytr::detail::AtomicFile::commitAll(pending.data(), pending.size(), 0);
+    });
+}
@@ -0,0 +1,34 @@
+#include <string>   // string
+#include <vector>   // vector
+
+#include "bench.hpp"
+
+// Retranslate a screen of 200 labels: a loop of single calls versus one batch call.
+BENCHMARK(batchTranslate)
+{
+    const size_t catalogSize = 100000;
+    const size_t screenSize = 200;
+
+    bench::useTranslations(bench::makeTranslations(catalogSize));
+
+    // Spread the labels of the screen over the catalog, with 10% misses.
+    std::vector<std::string> storage;
+    for (size_t i = 0; i < screenSize; ++i)
+        storage.push_back(i % 10 == 0 ? "Bench.Missing" + std::to_string(i) : bench::makeId(i * 499 % catalogSize));
+
+    std::vector<const char*> ids;
+    for (const auto& id : storage)
+        ids.push_back(id.c_str());
+    std::vector<const char*> texts(screenSize);
+
+    bench::measure("loop of translate()", screenSize, 200, [&]() {
+        for (size_t i = 0; i < screenSize; ++i)
+            texts[i] = easytr::translate(ids[i]);
+        bench::keep(texts.back());
+    });
+
+    bench::measure("batch translate()", screenSize, 200, [&]() {
+        easytr::translate(ids.data(), ids.size(), texts.data());
+        bench::keep(texts.back());
+    });
+}
@@ -0,0 +1,250 @@
+// The benchmarks of the "easy translate" library.
+//
+// Usage: EasyTranslate-Benchmark [name filter] [--json <results file>]
+//   - Run all benchmarks whose name contains the filter. (all benchmarks if no filter)
+//   - Write the measured values to the results file as json, to track the regressions across builds.
+
+#ifndef EASY_TRANSLATE_BENCH_HPP
+#define EASY_TRANSLATE_BENCH_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <chrono>       // steady_clock
+#include <cstdio>       // printf
+#include <filesystem>   // path, temp_directory_path
+#include <map>          // map
+#include <random>       // mt19937
+#include <string>       // string
+#include <vector>       // vector
+
+#include <easy_translate.hpp>
+
+namespace bench
+{
+
+using Function = void (*)();
+
+struct Benchmark
+{
+    const char* name;
+    Function function;
+};
+
+inline std::vector<Benchmark>& registry()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct Registrar
+{
+    Registrar(const char* name, Function function) { registry().push_back({ name, function }); }
+};
+
+// Define a benchmark that is run by the benchmark executable.
+#define BENCHMARK(name) \
+    static void name(); \
+    static bench::Registrar name##_registrar(#name, name); \
+    static void name()
+
+// A measured value, see the #measure() and #report().
+struct Result
+{
+    std::string benchmark;
+    std::string name;
+    double value;
+    std::string unit;
+};
+
+/// @brief Get the measured values of the benchmarks that have run.
+inline std::vector<Result>& results()
+{
+    static std::vector<Result> values;
+    return values;
+}
+
+/// @brief Get the name of the running benchmark, the measured values are recorded with it.
+inline std::string& currentBenchmark()
+{
+    static std::string name;
+    return name;
+}
+
+// Keeps the results of the measured code alive, so the compiler can not remove the code.
+inline volatile uintptr_t sink = 0;
+
+template <typename T>
+inline void keep(T* ptr) { sink = sink + reinterpret_cast<uintptr_t>(ptr); }
+
+/// @brief Run the function `rounds` times and print the nanoseconds per operation, the `setup` is called before
+/// each call of the function and not measured.
+/// @param ops The number of operations that one call of the function does.
+/// @return The nanoseconds per operation of the fastest round.
+template <typename Setup, typename Func>
+double measure(const char* name, size_t ops, size_t rounds, Setup setup, Func func)
+{
+    setup();
+    func(); // Warm up.
+
+    double best = 0;
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        setup();
+        auto begin = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - begin).count() / ops;
+        if (i == 0 || ns < best)
+            best = ns;
+    }
+
+    std::printf("  %-48s %12.2f ns/op\n", name, best);
+    results().push_back({ currentBenchmark(), name, best, "ns/op" });
+    return best;
+}
+
+/// @brief Run the function `rounds` times and print the nanoseconds per operation.
+/// @param ops The number of operations that one call of the function does.
+/// @return The nanoseconds per operation of the fastest round.
+template <typename Func>
+double measure(const char* name, size_t ops, size_t rounds, Func func)
+{
+    return measure(name, ops, rounds, []() {}, func);
+}
+
+/// @brief Get the bytes that allocated by the operator new and not deleted yet, including the overhead of
+/// the allocator.
+size_t allocatedBytes();
+
+/// @brief Get the highest bytes of the #allocatedBytes() since the last #resetPeakAllocatedBytes().
+size_t peakAllocatedBytes();
+
+/// @brief Start tracking the #peakAllocatedBytes() from the current allocated bytes.
+void resetPeakAllocatedBytes();
+
+/// @brief Print a measured value that is not a time.
+inline void report(const char* name, double value, const char* unit)
+{
+    std::printf("  %-48s %12.2f %s\n", name, value, unit);
+    results().push_back({ currentBenchmark(), name, value, unit });
+}
+
+/// @brief Get the `Translation ID` of the given index, like "Bench.Module3.Page12.Label45".
+inline std::string makeId(size_t index)
+{
+    return "Bench.Module" + std::to_string(index % 7) + ".Page" + std::to_string(index % 61) +
+           ".Label" + std::to_string(index);
+}
+
+/// @brief Get a `Translations` that has `count` entries, from makeId(0) to makeId(count - 1).
+inline easytr::Translations makeTranslations(size_t count)
+{
+    std::vector<std::pair<std::string, std::string>> trans;
+    trans.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        trans.push_back({ makeId(i), "Translated text of the label " + std::to_string(i) });
+    return easytr::Translations(trans);
+}
+
+// A synthetic catalog that looks like the catalog of a real application, see the #makeCatalog().
+struct Catalog
+{
+    // The json of the `Translations file`.
+    std::string json;
+    easytr::Translations translations;
+    // The `Translation ID`s in the order of the generation.
+    std::vector<std::string> ids;
+};
+
+/// @brief Generate a catalog of `count` entries, the same seed generates the same catalog.
+/// @note - The `Translation ID`s are hierarchical, 2 to 5 levels like "Settings.Network.Proxy.PortLabel3".
+/// @note - The `Translation text`s are mostly short ASCII labels and sentences, about a quarter are CJK, and a
+/// long tail (2%) are paragraphs of hundreds to thousands of bytes. About 3% are plural forms.
+inline Catalog makeCatalog(size_t count, unsigned seed = 1)
+{
+    static const char* const modules[] = {
+        "App", "Settings", "Editor", "Account", "Files", "Network", "Help", "Store", "Chat", "Media"
+    };
+    static const char* const groups[] = {
+        "General", "Advanced", "Dialog", "Menu", "Toolbar", "Status", "Errors", "Hints", "Wizard", "Panel",
+        "Proxy", "Privacy", "History", "Sync", "Export", "Import"
+    };
+    static const char* const names[] = {
+        "Title", "Label", "Button", "Tooltip", "Message", "Description", "Placeholder", "Caption", "Action"
+    };
+    static const char* const words[] = {
+        "open", "the", "file", "settings", "to", "save", "your", "changes", "before", "closing", "network",
+        "connection", "failed", "please", "try", "again", "later", "select", "an", "item", "from", "list"
+    };
+
+    std::mt19937 rng(seed);
+    auto pick = [&rng](size_t size) { return static_cast<size_t>(rng() % size); };
+    auto sentence = [&](size_t wordCount) {
+        std::string text;
+        for (size_t i = 0; i < wordCount; ++i)
+            text += (i == 0 ? "" : " ") + std::string(words[pick(sizeof(words) / sizeof(words[0]))]);
+        return text;
+    };
+    auto cjk = [&](size_t charCount) {
+        std::string text;
+        for (size_t i = 0; i < charCount; ++i)
+        {
+            // The CJK Unified Ideographs U+4E00 ~ U+9FFF, 3 bytes in UTF-8.
+            unsigned cp = 0x4E00 + static_cast<unsigned>(pick(0x9FFF - 0x4E00 + 1));
+            text += static_cast<char>(0xE0 | (cp >> 12));
+            text += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            text += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        return text;
+    };
+
+    // The generated strings need no escaping, so the json is written directly.
+    auto quote = [](const std::string& str) { return "\"" + str + "\""; };
+
+    Catalog catalog;
+    catalog.ids.reserve(count);
+    catalog.json = "{";
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string id = modules[pick(sizeof(modules) / sizeof(modules[0]))];
+        size_t depth = 1 + pick(3);
+        for (size_t level = 0; level < depth; ++level)
+            id += std::string(".") + groups[pick(sizeof(groups) / sizeof(groups[0]))];
+        id += std::string(".") + names[pick(sizeof(names) / sizeof(names[0]))] + std::to_string(i);
+
+        std::string value;
+        size_t kind = pick(100);
+        if (kind < 2)
+            value = quote(pick(2) ? sentence(40 + pick(300)) : cjk(100 + pick(600)));
+        else if (kind < 5)
+            value = "{\"one\": " + quote("{0} " + sentence(2)) + ", \"other\": " + quote("{0} " + sentence(3)) + "}";
+        else if (kind < 30)
+            value = quote(cjk(2 + pick(12)));
+        else
+            value = quote(sentence(1 + pick(8)));
+
+        catalog.json += (i == 0 ? "\n" : ",\n") + quote(id) + ": " + value;
+        catalog.ids.push_back(std::move(id));
+    }
+    catalog.json += "\n}\n";
+    catalog.translations = easytr::Translations::fromJson(catalog.json);
+    return catalog;
+}
+
+/// @brief Write the `Translations` to a temporary file and make it the current language.
+inline void useTranslations(const easytr::Translations& translations, const std::string& languageId = "Bench")
+{
+    namespace fs = std::filesystem;
+
+    fs::path dir = fs::temp_directory_path() / "easy_translate_bench";
+    fs::create_directories(dir);
+
+    std::string filename = (dir / "bench.json").string();
+    translations.toFile(filename);
+    easytr::setLanguages(easytr::Languages(std::map<std::string, std::string>{ { languageId, filename } }));
+    easytr::setCurrentLanguage(languageId);
+}
+
+} // namespace bench
+
+#endif // !EASY_TRANSLATE_BENCH_HPP
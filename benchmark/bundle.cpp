@@ -0,0 +1,46 @@
+#include <cstddef>    // size_t
+#include <map>        // map
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Load many languages from their own `Translations file`s versus from the catalogs of a single bundle file, that
+// is mapped into the memory once and has the prebuilt tables instead of the json. (see the easytr::Bundle)
+BENCHMARK(bundle)
+{
+    const size_t languageCount = 40;
+    const size_t count = 2000;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench";
+    std::filesystem::create_directories(dir);
+    std::string bundleFilename = (dir / "languages.bundle").string();
+
+    easytr::Translations translations = bench::makeTranslations(count);
+    std::map<std::string, easytr::Translations> catalogs;
+    std::vector<std::string> filenames;
+    for (size_t i = 0; i < languageCount; ++i)
+    {
+        std::string languageId = "Lang" + std::to_string(i);
+        filenames.push_back((dir / (languageId + ".json")).string());
+        translations.toFile(filenames.back());
+        catalogs[languageId] = translations;
+    }
+
+    bench::measure("Bundle::write()", 1, 5, [&]() {
+        easytr::Bundle::write(bundleFilename, catalogs);
+    });
+
+    easytr::Translations loaded;
+    bench::measure("load all languages from files", languageCount, 5, [&]() {
+        for (const auto& filename : filenames)
+            loaded = easytr::FileSource(filename).load();
+        bench::keep(&loaded);
+    });
+    bench::measure("load all languages from bundle", languageCount, 5, [&]() {
+        auto bundle = easytr::Bundle::open(bundleFilename);
+        for (const auto& var : catalogs)
+            loaded = easytr::BundleSource(bundle, var.first).load();
+        bench::keep(&loaded);
+    });
+}
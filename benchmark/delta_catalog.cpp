@@ -0,0 +1,67 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// The regional variants that override 3% of the entries of their parent: stored as full copies versus delta files
+// that are based on the parent, measure the switch between two variants and the lookups on a variant.
+BENCHMARK(deltaCatalog)
+{
+    const size_t count = 20000;
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(bench::makeId(i));
+
+    easytr::Translations parent = bench::makeTranslations(count);
+    easytr::Translations copy = parent;
+    easytr::Translations delta;
+    for (size_t i = 0; i < count; i += 33)
+    {
+        copy.add(ids[i], "Variant " + ids[i]);
+        delta.add(ids[i], "Variant " + ids[i]);
+    }
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench";
+    std::filesystem::create_directories(dir);
+    std::string parentFile = (dir / "parent.json").string();
+    std::string copyFile = (dir / "copy.json").string();
+    std::string deltaFile = (dir / "delta.json").string();
+    parent.toFile(parentFile);
+    copy.toFile(copyFile);
+    delta.toFile(deltaFile);
+
+    easytr::Languages languages;
+    languages.add("en_US", parentFile);
+    languages.add("en_GB_copy", copyFile);
+    languages.add("en_AU_copy", copyFile);
+    languages.add("en_GB", deltaFile);
+    languages.add("en_AU", deltaFile);
+    languages.setBase("en_GB", "en_US");
+    languages.setBase("en_AU", "en_US");
+    easytr::setLanguages(languages);
+
+    bench::measure("switch between the full copy variants", 2, 20, [&]() {
+        easytr::setCurrentLanguage("en_GB_copy");
+        easytr::setCurrentLanguage("en_AU_copy");
+    });
+
+    // The parent is kept loaded by the current variant, so only the delta file is loaded.
+    bench::measure("switch between the delta variants", 2, 20, [&]() {
+        easytr::setCurrentLanguage("en_GB");
+        easytr::setCurrentLanguage("en_AU");
+    });
+
+    easytr::setCurrentLanguage("en_GB_copy");
+    bench::measure("translate() full copy variant", count, 100, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+
+    easytr::setCurrentLanguage("en_GB");
+    bench::measure("translate() delta variant", count, 100, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+}
@@ -0,0 +1,65 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Switch to a language from its `Translations file` versus from the catalog that embedded into the binary by the
+// easy_translate_embed_catalog(), that does no file I/O and no json parsing. (see the CMakeLists.txt)
+BENCHMARK(embeddedCatalog)
+{
+    const size_t count = 10000;
+
+    const easytr::EmbeddedCatalog* catalog = easytr::findEmbeddedCatalog("EmbeddedBench");
+    if (!catalog)
+    {
+        std::printf("  The embedded catalog is not registered.\n");
+        return;
+    }
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(bench::makeId(i));
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench";
+    std::filesystem::create_directories(dir);
+    std::string filename = (dir / "embedded.json").string();
+    easytr::Translations::fromEmbedded(*catalog).toFile(filename);
+
+    easytr::Languages languages;
+    languages.add("File", filename);
+    languages.add("File2", filename);
+    languages.addEmbedded("Embedded", "EmbeddedBench");
+    languages.addEmbedded("Embedded2", "EmbeddedBench");
+    easytr::setLanguages(languages);
+
+    easytr::Translations translations;
+    bench::measure("Translations::fromFile()", 1, 20, [&]() {
+        translations = easytr::Translations::fromFile(filename);
+    });
+    bench::measure("Translations::fromEmbedded()", 1, 20, [&]() {
+        translations = easytr::Translations::fromEmbedded(*catalog);
+    });
+
+    bench::measure("setCurrentLanguage() from file", 2, 20, [&]() {
+        easytr::setCurrentLanguage("File2");
+        easytr::setCurrentLanguage("File");
+    });
+    bench::measure("setCurrentLanguage() from embedded catalog", 2, 20, [&]() {
+        easytr::setCurrentLanguage("Embedded2");
+        easytr::setCurrentLanguage("Embedded");
+    });
+
+    // The entries of an embedded catalog are built on their first lookups after the switch.
+    bench::measure("setCurrentLanguage() from embedded catalog + first translate()s", count, 20, [&]() {
+        easytr::setCurrentLanguage("Embedded2");
+        easytr::setCurrentLanguage("Embedded");
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+
+    bench::measure("translate() on embedded catalog", count, 200, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+}
@@ -0,0 +1,45 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Translate with a single `Translations` versus a regional language that has 10% of the entries and falls back to
+// the full language, the flattened index makes both the same single lookup.
+BENCHMARK(fallbackTranslate)
+{
+    const size_t count = 10000;
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(bench::makeId(i));
+
+    easytr::Translations base = bench::makeTranslations(count);
+    easytr::Translations regional;
+    for (size_t i = 0; i < count; i += 10)
+        regional.add(ids[i], "Regional " + ids[i]);
+
+    bench::useTranslations(base, "Base");
+    bench::measure("translate() single language", count, 200, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench";
+    std::string baseFile = (dir / "base.json").string();
+    std::string regionalFile = (dir / "regional.json").string();
+    base.toFile(baseFile);
+    regional.toFile(regionalFile);
+
+    easytr::Languages languages;
+    languages.add("Base", baseFile);
+    languages.add("Regional", regionalFile);
+    languages.setFallback("Regional", "Base");
+    easytr::setLanguages(languages);
+    easytr::setCurrentLanguage("Regional");
+
+    bench::measure("translate() with fallback language", count, 200, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+}
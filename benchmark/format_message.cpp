@@ -0,0 +1,48 @@
+#include <string>   // string
+
+#include "bench.hpp"
+
+// Build a label with two arguments: find-and-replace on the translated text versus the precompiled message.
+BENCHMARK(formatMessage)
+{
+    const size_t labels = 1000;
+
+    easytr::Translations translations = bench::makeTranslations(1000);
+    translations.add("Bench.Downloaded", "Downloaded {count} of {total} files");
+    bench::useTranslations(translations);
+
+    bench::measure("translate() and replace", labels, 200, [&]() {
+        for (size_t i = 0; i < labels; ++i)
+        {
+            std::string text = easytr::translate("Bench.Downloaded");
+            text.replace(text.find("{count}"), 7, std::to_string(i));
+            text.replace(text.find("{total}"), 7, std::to_string(labels));
+            bench::keep(text.data());
+        }
+    });
+
+    bench::measure("format()", labels, 200, [&]() {
+        for (size_t i = 0; i < labels; ++i)
+        {
+            easytr::FormattedText text = easytr::format("Bench.Downloaded",
+                                                        easytr::arg("count", i), easytr::arg("total", labels));
+            bench::keep(text.data());
+        }
+    });
+
+    char buffer[64];
+    bench::measure("formatTo()", labels, 200, [&]() {
+        for (size_t i = 0; i < labels; ++i)
+            easytr::formatTo(buffer, sizeof(buffer), "Bench.Downloaded",
+                             easytr::arg("count", i), easytr::arg("total", labels));
+        bench::keep(buffer);
+    });
+
+    // The `Translation ID` that not exists is formatted as the message pattern itself.
+    bench::measure("formatTo() of a missing Translation ID", labels, 200, [&]() {
+        for (size_t i = 0; i < labels; ++i)
+            easytr::formatTo(buffer, sizeof(buffer), "Bench.Missing {count} of {total}",
+                             easytr::arg("count", i), easytr::arg("total", labels));
+        bench::keep(buffer);
+    });
+}
@@ -0,0 +1,81 @@
+#include <atomic>               // atomic
+#include <condition_variable>   // condition_variable
+#include <cstddef>              // size_t
+#include <mutex>                // mutex, unique_lock
+#include <string>               // string
+#include <thread>               // thread
+#include <vector>               // vector
+
+#include "bench.hpp"
+
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+// Translate while the `Translations file` is rewritten and reloaded in the background versus without the reloads,
+// the reload never blocks the lookups. And the time from the file is written to the new `Translations` is published.
+BENCHMARK(hotReload)
+{
+    const size_t count = 10000;
+    const auto debounce = std::chrono::milliseconds(10);
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(bench::makeId(i));
+
+    easytr::Translations translations = bench::makeTranslations(count);
+    bench::useTranslations(translations, "HotReload");
+    std::string filename = easytr::languages().at("HotReload");
+    // Save by the rename like the editors, the file is never seen half written.
+    auto save = [&]() {
+        translations.toFile(filename + ".tmp");
+        std::filesystem::rename(filename + ".tmp", filename);
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t reloads = 0;
+    size_t listener = easytr::addReloadListener([&](const std::string&) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++reloads;
+        cv.notify_all();
+    });
+    easytr::startHotReload(debounce);
+
+    bench::measure("translate() without reload", count, 200, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+
+    std::atomic<bool> stopped(false);
+    std::thread writer([&]() {
+        while (!stopped)
+        {
+            save();
+            std::this_thread::sleep_for(debounce * 3);
+        }
+    });
+    bench::measure("translate() while reloading", count, 200, [&]() {
+        for (const auto& id : ids)
+            bench::keep(easytr::translate(id.c_str()));
+    });
+    stopped = true;
+    writer.join();
+
+    // Wait for the last reload.
+    std::this_thread::sleep_for(debounce * 5);
+
+    const size_t rounds = 10;
+    double total = 0;
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        size_t before = reloads;
+        auto begin = std::chrono::steady_clock::now();
+        save();
+        cv.wait(lock, [&]() { return reloads != before; });
+        total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+    bench::report("reload latency (10 ms debounce)", total / rounds, "ms");
+
+    easytr::stopHotReload();
+    easytr::removeReloadListener(listener);
+}
+#endif // EASY_TRANSLATE_HOT_RELOAD
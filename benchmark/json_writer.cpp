@@ -0,0 +1,43 @@
+#include <cstddef>    // size_t
+#include <fstream>    // ofstream
+#include <string>     // string
+
+#include "bench.hpp"
+
+// Write a large `Translations` by building the nlohmann::json and its dump(4) string (as the toFile() did before)
+// versus the streaming writer of the toFile(), that writes the same json through a small buffer.
+BENCHMARK(jsonWriter)
+{
+    const size_t count = 500000;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench";
+    std::filesystem::create_directories(dir);
+    std::string filename = (dir / "writer.json").string();
+
+    easytr::Translations translations = bench::makeTranslations(count);
+
+    auto writeDom = [&]() {
+        nlohmann::json j;
+        for (const auto& item : translations.withPrefix(""))
+            j[item.id()] = easytr::detail::entryToJson(*item.entry);
+        std::ofstream ofs(filename);
+        ofs << j.dump(4);
+    };
+    auto writeStream = [&]() { translations.toFile(filename); };
+
+    bench::measure("json DOM and dump(4) to file", count, 3, writeDom);
+    bench::measure("toFile() streaming", count, 3, writeStream);
+
+    bench::resetPeakAllocatedBytes();
+    size_t before = bench::allocatedBytes();
+    writeDom();
+    bench::report("peak memory of json DOM and dump(4)",
+                  static_cast<double>(bench::peakAllocatedBytes() - before) / (1024 * 1024), "MiB");
+
+    bench::resetPeakAllocatedBytes();
+    before = bench::allocatedBytes();
+    writeStream();
+    bench::report("peak memory of toFile() streaming",
+                  static_cast<double>(bench::peakAllocatedBytes() - before) / (1024 * 1024), "MiB");
+    bench::report("file size", static_cast<double>(std::filesystem::file_size(filename)) / (1024 * 1024), "MiB");
+}
@@ -0,0 +1,52 @@
+#include <cstdio>   // printf, fprintf
+#include <cstring>  // strcmp, strstr
+#include <fstream>  // ofstream
+
+#include "bench.hpp"
+
+int main(int argc, char* argv[])
+{
+    const char* filter = "";
+    const char* resultsFile = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            resultsFile = argv[++i];
+        else
+            filter = argv[i];
+    }
+
+    for (const auto& benchmark : bench::registry())
+    {
+        if (std::strstr(benchmark.name, filter) == nullptr)
+            continue;
+
+        std::printf("%s\n", benchmark.name);
+        bench::currentBenchmark() = benchmark.name;
+        benchmark.function();
+    }
+
+    if (resultsFile)
+    {
+        nlohmann::json j = nlohmann::json::array();
+        for (const auto& result : bench::results())
+        {
+            j.push_back({
+                { "benchmark", result.benchmark },
+                { "name", result.name },
+                { "value", result.value },
+                { "unit", result.unit }
+            });
+        }
+
+        std::ofstream ofs(resultsFile);
+        ofs << j.dump(4) << '\n';
+        if (!ofs)
+        {
+            std::fprintf(stderr, "Failed to write the file: %s\n", resultsFile);
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "bench.hpp"
+
+// Format a select/plural message: the bytecode compiled at load versus parsing the pattern on each call.
+BENCHMARK(messageBytecode)
+{
+    const long long calls = 1000;
+    const char* pattern = "{gender, select, female {{count, plural, =0 {She has no messages.} one {She has # message.} "
+                          "other {She has # messages.}}} other {{count, plural, =0 {He has no messages.} "
+                          "one {He has # message.} other {He has # messages.}}}}";
+
+    easytr::Translations translations = bench::makeTranslations(1000);
+    translations.add("Bench.Messages", pattern);
+    bench::useTranslations(translations, "en");
+
+    char buffer[64];
+    bench::measure("parse on each call", calls, 200, [&]() {
+        for (long long i = 0; i < calls; ++i)
+        {
+            // The pattern is not a `Translation ID` of the catalog, so it is compiled for the call.
+            easytr::formatTo(buffer, sizeof(buffer), pattern,
+                             easytr::arg("gender", i % 2 ? "female" : "male"), easytr::arg("count", i % 3));
+        }
+        bench::keep(buffer);
+    });
+
+    bench::measure("compiled at load", calls, 200, [&]() {
+        for (long long i = 0; i < calls; ++i)
+        {
+            easytr::formatTo(buffer, sizeof(buffer), "Bench.Messages",
+                             easytr::arg("gender", i % 2 ? "female" : "male"), easytr::arg("count", i % 3));
+        }
+        bench::keep(buffer);
+    });
+}
@@ -0,0 +1,95 @@
+#include <cstddef>    // size_t
+#include <cstdint>    // uint64_t
+#include <map>        // map
+#include <set>        // set
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// A hierarchical catalog like "App.Settings.Page12.Widget7.Tooltip" in the nested json: the memory of the
+// `Translations` that shares the namespaces, versus the flat std::string keys with the same hash index,
+// and the memory of the keys alone.
+BENCHMARK(nestedNamespace)
+{
+    const char* modules[] = { "Settings", "Editor", "Dashboard", "Notifications",
+                              "Account", "Billing", "Reports", "Integrations" };
+    const char* properties[] = { "Label", "Tooltip", "Placeholder", "Description", "Shortcut" };
+
+    nlohmann::json j;
+    std::vector<std::string> ids;
+    std::vector<std::string> texts;
+    for (const char* module : modules)
+    {
+        for (int page = 0; page < 25; ++page)
+        {
+            for (int widget = 0; widget < 20; ++widget)
+            {
+                for (const char* property : properties)
+                {
+                    std::string text = std::string(property) + " of the widget " + std::to_string(widget);
+                    j["App"][module]["Page" + std::to_string(page)]["Widget" + std::to_string(widget)][property] = text;
+                    ids.push_back(std::string("App.") + module + ".Page" + std::to_string(page) + ".Widget" +
+                                  std::to_string(widget) + "." + property);
+                    texts.push_back(text);
+                }
+            }
+        }
+    }
+    std::string json = j.dump();
+
+    size_t before = bench::allocatedBytes();
+    {
+        // The flat keys with the hash index of the same load factor.
+        struct Slot
+        {
+            uint64_t hash;
+            const void* item;
+        };
+
+        std::map<std::string, easytr::detail::Entry> flat;
+        for (size_t i = 0; i < ids.size(); ++i)
+            flat.insert({ ids[i], easytr::detail::Entry(texts[i]) });
+        size_t capacity = 16;
+        while (flat.size() * 2 > capacity)
+            capacity *= 2;
+        std::vector<Slot> slots(capacity);
+
+        double bytes = static_cast<double>(bench::allocatedBytes() - before);
+        bench::report("flat std::string keys", bytes / ids.size(), "bytes/entry");
+    }
+
+    before = bench::allocatedBytes();
+    {
+        std::vector<std::string> keys(ids.begin(), ids.end());
+        double bytes = static_cast<double>(bench::allocatedBytes() - before);
+        bench::report("keys only: flat std::string", bytes / ids.size(), "bytes/entry");
+    }
+
+    before = bench::allocatedBytes();
+    {
+        std::set<std::string> spaces;
+        std::vector<easytr::detail::TranslationKey> keys;
+        keys.reserve(ids.size());
+        for (const auto& id : ids)
+        {
+            size_t split = id.rfind('.') + 1;
+            keys.emplace_back(&*spaces.insert(id.substr(0, split)).first, id.substr(split));
+        }
+        double bytes = static_cast<double>(bench::allocatedBytes() - before);
+        bench::report("keys only: shared namespace and name", bytes / ids.size(), "bytes/entry");
+    }
+
+    before = bench::allocatedBytes();
+    {
+        easytr::Translations translations = easytr::Translations::fromJson(json);
+        double bytes = static_cast<double>(bench::allocatedBytes() - before);
+        bench::report("Translations with shared namespaces", bytes / ids.size(), "bytes/entry");
+    }
+
+    easytr::Translations translations = easytr::Translations::fromJson(json);
+    bench::measure("Translations::at()", ids.size(), 50, [&]() {
+        for (const auto& id : ids)
+            bench::keep(translations.at(id.c_str()));
+    });
+}
@@ -0,0 +1,55 @@
+#include <cstddef>    // size_t
+#include <memory>     // make_shared
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// The tenants that override 10 entries of a shared catalog: a full `Translations` copy per tenant versus an
+// `Overlay` per tenant, measure the creation of a tenant and the lookups on it.
+BENCHMARK(overlayTranslate)
+{
+    const size_t count = 20000;
+    const size_t tenants = 100;
+    const size_t overrides = 10;
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < count; ++i)
+        ids.push_back(bench::makeId(i));
+
+    std::shared_ptr<const easytr::Translations> base =
+        std::make_shared<const easytr::Translations>(bench::makeTranslations(count));
+
+    std::vector<easytr::Translations> copies(tenants);
+    bench::measure("create tenant as Translations copy", tenants, 5, [&]() {
+        for (size_t t = 0; t < tenants; ++t)
+        {
+            copies[t] = *base;
+            for (size_t i = 0; i < overrides; ++i)
+            {
+                copies[t].remove(ids[t * 37 + i * 1009]);
+                copies[t].add(ids[t * 37 + i * 1009], "Tenant " + std::to_string(t));
+            }
+        }
+    });
+
+    std::vector<easytr::Overlay> overlays(tenants);
+    bench::measure("create tenant as Overlay", tenants, 5, [&]() {
+        for (size_t t = 0; t < tenants; ++t)
+        {
+            overlays[t] = easytr::Overlay(base);
+            for (size_t i = 0; i < overrides; ++i)
+                overlays[t].add(ids[t * 37 + i * 1009], "Tenant " + std::to_string(t));
+        }
+    });
+
+    bench::measure("Translations::at() tenant copy", count, 50, [&]() {
+        for (const auto& id : ids)
+            bench::keep(copies[7].at(id.c_str()));
+    });
+
+    bench::measure("Overlay::at() tenant overlay", count, 50, [&]() {
+        for (const auto& id : ids)
+            bench::keep(overlays[7].at(id.c_str()));
+    });
+}
@@ -0,0 +1,35 @@
+#include "bench.hpp"
+
+// Choose the plural form of a label: separate IDs with a hand-written branch versus translatePlural().
+BENCHMARK(pluralTranslate)
+{
+    const long long counts = 1000;
+
+    easytr::Translations translations = bench::makeTranslations(1000);
+    translations.add("Bench.File.One", "{0} файл");
+    translations.add("Bench.File.Few", "{0} файла");
+    translations.add("Bench.File.Many", "{0} файлов");
+    translations.addPlural("Bench.File", { { "one", "{0} файл" }, { "few", "{0} файла" }, { "many", "{0} файлов" },
+                                           { "other", "{0} файла" } });
+    bench::useTranslations(translations, "ru_RU");
+
+    bench::measure("hand-written branch", counts, 200, [&]() {
+        for (long long n = 0; n < counts; ++n)
+        {
+            long long n10 = n % 10, n100 = n % 100;
+            const char* text;
+            if (n10 == 1 && n100 != 11)
+                text = easytr::translate("Bench.File.One");
+            else if (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14))
+                text = easytr::translate("Bench.File.Few");
+            else
+                text = easytr::translate("Bench.File.Many");
+            bench::keep(text);
+        }
+    });
+
+    bench::measure("translatePlural()", counts, 200, [&]() {
+        for (long long n = 0; n < counts; ++n)
+            bench::keep(easytr::translatePlural("Bench.File", n));
+    });
+}
@@ -0,0 +1,40 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Enumerate the `Translation text`s of a namespace of a 200k entries `Translations`: filter the getIds() versus
+// the withPrefix().
+BENCHMARK(prefixQuery)
+{
+    const size_t count = 200000;
+    const std::string prefix = "Bench.Module3.Page12.";
+
+    easytr::Translations translations = bench::makeTranslations(count);
+
+    size_t matched = 0;
+    bench::measure("getIds() and filter", 1, 10, [&]() {
+        matched = 0;
+        for (const auto& id : translations.getIds())
+        {
+            if (id.compare(0, prefix.size(), prefix) == 0)
+            {
+                bench::keep(translations.at(id));
+                ++matched;
+            }
+        }
+    });
+
+    bench::measure("withPrefix()", 1, 1000, [&]() {
+        for (const auto& var : translations.withPrefix(prefix))
+            bench::keep(var.text().data);
+    });
+
+    bench::measure("withPrefix() partial name \"Bench.Module3.Pa\"", 1, 100, [&]() {
+        for (const auto& var : translations.withPrefix("Bench.Module3.Pa"))
+            bench::keep(var.text().data);
+    });
+
+    bench::report("matched entries", static_cast<double>(matched), "entries");
+}
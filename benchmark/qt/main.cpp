@@ -0,0 +1,106 @@
+// Retranslate 10k labels on the QEvent::LanguageChange, with the offscreen platform so it runs headless.
+// Before each round the language is switched between two languages, so the texts really change and the
+// QtTranslator cache is rebuilt for the new language. The switch loads the `Translations file`, so it is not
+// measured, only the retranslation is.
+//   - "fromUtf8(translate())": each label converts the result of the easytr::translate() to the QString.
+//   - "tr() by QtTranslator": each label gets the cached QString by the QCoreApplication::translate().
+
+#include <filesystem> // path
+#include <string>     // string
+#include <utility>    // pair
+#include <vector>     // vector
+
+#include <QApplication>
+#include <QEvent>
+#include <QLabel>
+#include <QWidget>
+
+#include <easy_translate_qt.hpp>
+
+#include "../bench.hpp"
+
+// A label that retranslates itself on the QEvent::LanguageChange, like the widgets of the applications.
+class Label : public QLabel
+{
+public:
+    Label(const char* tranId, bool useTr, QWidget* parent) : QLabel(parent), tranId_(tranId), useTr_(useTr)
+    { retranslate(); }
+
+protected:
+    void changeEvent(QEvent* event) override
+    {
+        if (event->type() == QEvent::LanguageChange)
+            retranslate();
+        QLabel::changeEvent(event);
+    }
+
+private:
+    void retranslate()
+    {
+        if (useTr_)
+            setText(QCoreApplication::translate("Bench", tranId_));
+        else
+            setText(QString::fromUtf8(easytr::translate(tranId_)));
+    }
+
+    const char* tranId_;
+    bool useTr_;
+};
+
+int main(int argc, char* argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    const size_t labelCount = 10000;
+
+    // The second language has other texts for the same `Translation ID`s.
+    namespace fs = std::filesystem;
+    fs::path dir = fs::temp_directory_path() / "easy_translate_bench";
+    fs::create_directories(dir);
+    bench::makeTranslations(labelCount).toFile((dir / "qt_a.json").string());
+    std::vector<std::pair<std::string, std::string>> other;
+    for (size_t i = 0; i < labelCount; ++i)
+        other.push_back({ bench::makeId(i), "Other text of the label " + std::to_string(i) });
+    easytr::Translations(other).toFile((dir / "qt_b.json").string());
+
+    easytr::Languages languages;
+    languages.add("A", (dir / "qt_a.json").string());
+    languages.add("B", (dir / "qt_b.json").string());
+    easytr::setLanguages(languages);
+    easytr::setCurrentLanguage("A");
+    easytr::QtTranslator translator;
+    QCoreApplication::installTranslator(&translator);
+
+    std::vector<std::string> ids;
+    for (size_t i = 0; i < labelCount; ++i)
+        ids.push_back(bench::makeId(i));
+
+    QWidget utf8Root;
+    QWidget trRoot;
+    for (const auto& id : ids)
+    {
+        new Label(id.c_str(), false, &utf8Root);
+        new Label(id.c_str(), true, &trRoot);
+    }
+
+    bool useB = true;
+    auto switchLanguage = [&]() {
+        easytr::setCurrentLanguage(useB ? "B" : "A");
+        useB = !useB;
+    };
+    // Like the QtTranslator::setCurrentLanguage(), but the event is only sent to the measured labels, the
+    // QApplication would post it to the other root too.
+    QEvent event(QEvent::LanguageChange);
+
+    std::printf("qtRetranslate\n");
+    bench::measure("fromUtf8(translate())", labelCount, 20, switchLanguage, [&]() {
+        QCoreApplication::sendEvent(&utf8Root, &event);
+    });
+    bench::measure("tr() by QtTranslator", labelCount, 20, switchLanguage, [&]() {
+        QCoreApplication::sendEvent(&trRoot, &event);
+    });
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// A catalog of 60 modules with 1000 entries each: a monolithic file versus the split files by the namespace,
+// measure the startup that looks up the first screen (2 modules), and the language switch after it.
+BENCHMARK(splitCatalog)
+{
+    const size_t modules = 60;
+    const size_t entries = 1000;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench" / "split";
+    std::filesystem::create_directories(dir);
+
+    easytr::Translations monolithic;
+    nlohmann::json manifest;
+    for (size_t m = 0; m < modules; ++m)
+    {
+        std::string space = "Module" + std::to_string(m);
+        easytr::Translations module;
+        for (size_t i = 0; i < entries; ++i)
+        {
+            std::string name = "Page" + std::to_string(i % 20) + ".Label" + std::to_string(i);
+            std::string text = "Translated text of the label " + std::to_string(i);
+            monolithic.add(space + "." + name, text);
+            module.add(name, text);
+        }
+        module.toFile((dir / (space + ".json")).string());
+        manifest[space] = space + ".json";
+    }
+    monolithic.toFile((dir / "monolithic.json").string());
+    std::ofstream((dir / "manifest.json").string()) << manifest.dump(4);
+
+    easytr::Languages languages;
+    languages.add("Monolithic", (dir / "monolithic.json").string());
+    languages.add("Monolithic2", (dir / "monolithic.json").string());
+    languages.addManifest("Split", (dir / "manifest.json").string());
+    languages.addManifest("Split2", (dir / "manifest.json").string());
+
+    auto firstScreen = []() {
+        bench::keep(easytr::translate("Module0.Page1.Label1"));
+        bench::keep(easytr::translate("Module7.Page2.Label2"));
+    };
+
+    bench::measure("startup monolithic", 1, 10, [&]() {
+        easytr::setLanguages(languages);
+        easytr::setCurrentLanguage("Monolithic");
+        firstScreen();
+    });
+
+    bench::measure("startup split", 1, 10, [&]() {
+        easytr::setLanguages(languages);
+        easytr::setCurrentLanguage("Split");
+        firstScreen();
+    });
+
+    easytr::setCurrentLanguage("Monolithic");
+    bench::measure("switch monolithic", 2, 10, [&]() {
+        easytr::setCurrentLanguage("Monolithic2");
+        firstScreen();
+        easytr::setCurrentLanguage("Monolithic");
+        firstScreen();
+    });
+
+    // Only the 2 namespaces in use are loaded on the switch.
+    easytr::setCurrentLanguage("Split");
+    firstScreen();
+    bench::measure("switch split", 2, 10, [&]() {
+        easytr::setCurrentLanguage("Split2");
+        firstScreen();
+        easytr::setCurrentLanguage("Split");
+        firstScreen();
+    });
+
+    easytr::Translations all;
+    bench::measure("Translations::fromManifest() all files in parallel", 1, 10, [&]() {
+        all = easytr::Translations::fromManifest((dir / "manifest.json").string());
+    });
+
+    bench::measure("Translations::fromFile() monolithic", 1, 10, [&]() {
+        all = easytr::Translations::fromFile((dir / "monolithic.json").string());
+    });
+}
@@ -0,0 +1,70 @@
+#include <cstddef>    // size_t
+#include <fstream>    // ofstream
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// The core operations on the synthetic catalogs (see the bench::makeCatalog()) from 1k to 1M entries, their names
+// end with the size like "translate() hit [10000]" so the results of each size are tracked separately.
+// (the updateTranslationsFiles() is measured by the EasyTranslate-UpdateBenchmark, see the update/main.cpp)
+BENCHMARK(suite)
+{
+    const size_t sizes[] = { 1000, 10000, 100000, 1000000 };
+    const size_t lookups = 100000;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench" / "suite";
+    std::filesystem::create_directories(dir);
+
+    for (size_t size : sizes)
+    {
+        const std::string suffix = " [" + std::to_string(size) + "]";
+        const size_t rounds = size >= 1000000 ? 2 : (size >= 100000 ? 3 : 10);
+        auto name = [&suffix](const char* operation) { return operation + suffix; };
+
+        bench::Catalog catalog = bench::makeCatalog(size);
+        std::string filename = (dir / ("catalog" + std::to_string(size) + ".json")).string();
+        std::ofstream(filename, std::ios::binary) << catalog.json;
+        bench::report(name("file size").c_str(), static_cast<double>(catalog.json.size()) / 1024, "KiB");
+
+        easytr::Translations translations;
+        bench::measure(name("Translations::fromFile()").c_str(), size, rounds, [&]() {
+            translations = easytr::Translations::fromFile(filename);
+        });
+
+        std::string json;
+        bench::measure(name("Translations::toJson()").c_str(), size, rounds, [&]() {
+            json = translations.toJson();
+        });
+        bench::measure(name("Translations::toFile()").c_str(), size, rounds, [&]() {
+            translations.toFile((dir / "written.json").string());
+        });
+
+        easytr::Languages languages;
+        languages.add("A", filename);
+        languages.add("B", filename);
+        easytr::setLanguages(languages);
+        bench::measure(name("setCurrentLanguage()").c_str(), 2, rounds, [&]() {
+            easytr::setCurrentLanguage("B");
+            easytr::setCurrentLanguage("A");
+        });
+
+        // The lookups are spread over the whole catalog, the misses share the namespaces of the hits.
+        std::vector<std::string> hits;
+        std::vector<std::string> misses;
+        for (size_t i = 0; i < lookups; ++i)
+        {
+            const std::string& id = catalog.ids[(i * 7919) % size];
+            hits.push_back(id);
+            misses.push_back(id + "Missing");
+        }
+        bench::measure(name("translate() hit").c_str(), lookups, 20, [&]() {
+            for (const auto& id : hits)
+                bench::keep(easytr::translate(id.c_str()));
+        });
+        bench::measure(name("translate() miss").c_str(), lookups, 20, [&]() {
+            for (const auto& id : misses)
+                bench::keep(easytr::translate(id.c_str()));
+        });
+    }
+}
@@ -0,0 +1,32 @@
+#include <string>   // string
+
+#include "bench.hpp"
+
+// Copy a long help text to a std::string: count the result of translate() versus the length of translateView().
+BENCHMARK(translateView)
+{
+    const size_t copies = 1000;
+
+    easytr::Translations translations = bench::makeTranslations(1000);
+    std::string help;
+    for (int i = 0; i < 40; ++i)
+        help += "Select the files to synchronize, then press Start to copy them to the remote folder. ";
+    translations.add("Bench.Help", help);
+    bench::useTranslations(translations);
+
+    bench::measure("std::string(translate())", copies, 200, [&]() {
+        for (size_t i = 0; i < copies; ++i)
+        {
+            std::string text = easytr::translate("Bench.Help");
+            bench::keep(text.data());
+        }
+    });
+
+    bench::measure("translateView().str()", copies, 200, [&]() {
+        for (size_t i = 0; i < copies; ++i)
+        {
+            std::string text = easytr::translateView("Bench.Help").str();
+            bench::keep(text.data());
+        }
+    });
+}
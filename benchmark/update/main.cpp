@@ -0,0 +1,52 @@
+#include <cstddef>    // size_t
+#include <string>     // string
+#include <vector>     // vector
+
+#include "bench.hpp"
+
+// Update the `Translations file`s of 4 languages whose `Translation ID`s are all collected by the translate(),
+// when no file changes (they are only read and compared) and when a new `Translation ID` changes all of them.
+// The synthetic catalogs are the same as the suite benchmark of the EasyTranslate-Benchmark.
+BENCHMARK(update)
+{
+    const size_t sizes[] = { 1000, 10000, 100000, 1000000 };
+    const size_t languageCount = 4;
+
+    auto dir = std::filesystem::temp_directory_path() / "easy_translate_bench" / "update";
+    std::filesystem::create_directories(dir);
+
+    for (size_t size : sizes)
+    {
+        const std::string suffix = " [" + std::to_string(size) + "]";
+        const size_t rounds = size >= 1000000 ? 2 : (size >= 100000 ? 3 : 10);
+        auto name = [&suffix](const char* operation) { return operation + suffix; };
+
+        // The catalogs of one seed are the prefixes of each other, so the collected `Translation ID`s of the
+        // smaller sizes are in the larger catalogs.
+        bench::Catalog catalog = bench::makeCatalog(size);
+        easytr::Languages languages;
+        for (size_t i = 0; i < languageCount; ++i)
+        {
+            std::string filename = (dir / ("lang" + std::to_string(i) + ".json")).string();
+            catalog.translations.toFile(filename);
+            languages.add("Lang" + std::to_string(i), filename);
+        }
+
+        easytr::setLanguages(languages);
+        easytr::setCurrentLanguage("Lang0");
+        for (const auto& id : catalog.ids)
+            easytr::translate(id);
+
+        // Bring the files to the format of the update first, so the next updates change nothing.
+        easytr::updateTranslationsFiles(0);
+        bench::measure(name("updateTranslationsFiles(0) unchanged").c_str(), languageCount, rounds, [&]() {
+            easytr::updateTranslationsFiles(0);
+        });
+
+        static size_t added = 0;
+        bench::measure(name("updateTranslationsFiles(0) changed").c_str(), languageCount, rounds, [&]() {
+            easytr::translate("Bench.Added.Id" + std::to_string(added++));
+            easytr::updateTranslationsFiles(0);
+        });
+    }
+}
@@ -0,0 +1,39 @@
+#include <string>   // u16string
+
+#include "bench.hpp"
+
+// Show a label to a UTF-16 consumer: transcode the result of translate() versus the pre-transcoded translateU16().
+BENCHMARK(utf16Translate)
+{
+    const size_t labels = 1000;
+
+    easytr::Translations translations = bench::makeTranslations(labels);
+    translations.add("Bench.Help.Ascii", "Select the files to synchronize, then press Start to copy them to the "
+                                         "remote folder. Existing files are only replaced when they are older.");
+    translations.add("Bench.Help.Chinese", "选择要同步的文件，然后按“开始”将它们复制到远程文件夹。"
+                                           "只有较旧的现有文件才会被替换。");
+    bench::useTranslations(translations);
+
+    for (const char* id : { "Bench.Help.Ascii", "Bench.Help.Chinese" })
+    {
+        std::string name = std::string(id).substr(11);
+        bench::measure(("translate() and transcode, " + name).c_str(), labels, 200, [&]() {
+            for (size_t i = 0; i < labels; ++i)
+            {
+                const char* text = easytr::translate(id);
+                std::u16string utf16 = easytr::detail::utf8ToUtf16(text, std::strlen(text));
+                bench::keep(utf16.data());
+            }
+        });
+
+        bench::measure(("translateU16(), " + name).c_str(), labels, 200, [&]() {
+            for (size_t i = 0; i < labels; ++i)
+                bench::keep(easytr::translateU16(id).data());
+        });
+    }
+
+    bench::measure("translateU16() of a missing Translation ID", labels, 200, [&]() {
+        for (size_t i = 0; i < labels; ++i)
+            bench::keep(easytr::translateU16("Bench.Help.Missing").data());
+    });
+}
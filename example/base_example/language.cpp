@@ -1,9 +1,8 @@
 #include "language.h"
 
-#include <qapplication.h>
-#include <qevent.h>
+#include <qdebug.h>
 
-#include <easy_translate.hpp>
+#include <easy_translate_qt.hpp>
 
 #define LANG_ID_EN "En"
 #define LANG_ID_ZH "Zh"
@@ -22,15 +21,14 @@ QString getLanguageIdStr(LanguageID langId)
 
 void setLanguage(LanguageID langId)
 {
-    bool ret = easytr::setCurrentLanguage(getLanguageIdStr(langId).toStdString());
+    // Set the current language and send the QEvent::LanguageChange to the widgets.
+    bool ret = easytr::QtTranslator::setCurrentLanguage(getLanguageIdStr(langId).toStdString());
     if (!ret)
     {
         qDebug() << "Failed to set the current language to: " << getLanguageIdStr(langId);
         return;
     }
     gCurrentLanguage = langId;
-    QEvent event(QEvent::LanguageChange);
-    qApp->sendEvent(qApp, &event);
 }
 
 LanguageID currentLanguage()
@@ -1,6 +1,7 @@
 #include <qapplication.h>
 
 #include <easy_translate.hpp>
+#include <easy_translate_qt.hpp>
 
 #include "mainwidget.h"
 #include "language.h"
@@ -12,6 +13,10 @@ int main(int argc, char* argv[])
     QApplication a(argc, argv);
 
     easytr::setLanguages(APP_LANGUAGES_FILENAME);
+
+    // Serve the tr() from the easytr.
+    easytr::QtTranslator translator;
+    QApplication::installTranslator(&translator);
     setLanguage(currentLanguage());
 
     MainWidget w;
@@ -2,8 +2,6 @@
 
 #include <qlayout.h>
 
-#include <easy_translate.hpp>
-
 #include "language.h"
 
 MainWidget::MainWidget(QWidget* parent)
@@ -24,9 +22,10 @@ MainWidget::MainWidget(QWidget* parent)
 
 void MainWidget::updateText()
 {
-    setWindowTitle(EASYTR("EasyTranslateExample"));
-    textLbl_.setText(EASYTR("DisplayText"));
-    toggleLanguageBtn_.setText(EASYTR("ToggleLanguage"));
+    // The tr() is served by the easytr::QtTranslator, the source text is the `Translation ID`.
+    setWindowTitle(tr("EasyTranslateExample"));
+    textLbl_.setText(tr("DisplayText"));
+    toggleLanguageBtn_.setText(tr("ToggleLanguage"));
 }
 
 void MainWidget::changeEvent(QEvent* event)
@@ -10,12 +10,28 @@
 #ifndef EASY_TRANSLATE_HPP
 #define EASY_TRANSLATE_HPP
 
+#include <algorithm>            // sort
+#include <cerrno>               // errno
 #include <cstddef>              // size_t
+#include <cstdint>              // uint64_t
+#include <cstdio>               // snprintf
+#include <cstring>              // strlen, memcmp, memcpy, memchr
+#include <initializer_list>     // initializer_list
 #include <string>               // string
+#include <type_traits>          // enable_if
 #include <vector>               // vector
 #include <set>                  // set
 #include <map>                  // map
+#include <memory>               // shared_ptr
+#include <atomic>               // atomic
+#include <mutex>                // mutex
+#include <condition_variable>   // condition_variable
+#include <chrono>               // milliseconds
+#include <exception>            // exception
 #include <fstream>              // ifstream
+#include <ostream>              // ostream
+#include <iterator>             // istreambuf_iterator
+#include <thread>               // thread, this_thread
 
 #include <nlohmann/json.hpp>    // json
 
@@ -24,11 +40,170 @@
 /// all `Translation ID` to memory used for possible update the `Translations file`s.
 // #define EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
 
+/// @brief Define this macro to record the `Translation ID` of each EASYTR() into a dedicated section of the
+/// binary at compile time, all of them can be got by easytr::registeredIds() at runtime and they are used by
+/// the easytr::updateTranslationsFiles() function.
+/// @note - Unlike the \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES, it costs nothing on the
+/// easytr::TranslateManager::translate() function, and it also finds the `Translation ID`s on the code paths
+/// that never run.
+/// @note - When define this macro, only the string literal can be passed to the EASYTR(),
+/// call the easytr::translate() function directly for the other `Translation ID`s.
+/// @note - Only supported on the ELF platforms (e.g. Linux) with GCC or Clang.
+// #define EASY_TRANSLATE_ID_REGISTRY
+
+/// @brief Define this macro to count the lookups of each `Translation ID` on each language in the
+/// easytr::TranslateManager::translate() function, see the easytr::profileReport().
+/// @note The counting costs a few nanoseconds per lookup, and nothing when undefine this macro.
+// #define EASY_TRANSLATE_PROFILE
+
+/// @brief Define this macro to record each missing pair of the `Language ID` and `Translation ID` once until it
+/// is taken, see the easytr::takeMissingTranslations() and easytr::startMissingTranslationsDump().
+/// @note The recording never blocks and never allocates memory, the pairs beyond the capacity
+/// (\ref EASY_TRANSLATE_MISSING_LOG_CAPACITY) of the records that are not taken yet are dropped.
+// #define EASY_TRANSLATE_MISSING_LOG
+
+#ifndef EASY_TRANSLATE_MISSING_LOG_CAPACITY
+// The max number of the recorded missing translations that are not taken yet, should be a power of 2.
+#define EASY_TRANSLATE_MISSING_LOG_CAPACITY 1024
+#endif // !EASY_TRANSLATE_MISSING_LOG_CAPACITY
+
+/// @brief Define this macro to enable the easytr::startHotReload() function, it watches the `Translations file`s
+/// of the current language and the `Languages file` and reloads the current language when they change.
+/// @note Only supported on Linux. (by the inotify)
+// #define EASY_TRANSLATE_HOT_RELOAD
+
+/// @brief Define this macro to keep the UTF-16 `Translation text`s also, they are transcoded once when the
+/// `Translations` is loaded, see the easytr::translateU16().
+/// @note It requires C++17, and the `Translations` takes about three times the memory of the `Translation text`s.
+// #define EASY_TRANSLATE_UTF16
+
+#if defined(_MSVC_LANG) && _MSVC_LANG > __cplusplus
+#define EASY_TRANSLATE_CPLUSPLUS _MSVC_LANG
+#else
+#define EASY_TRANSLATE_CPLUSPLUS __cplusplus
+#endif
+
+#if EASY_TRANSLATE_CPLUSPLUS >= 201703L
+#include <string_view>          // string_view, u16string_view
+#endif
+
+#ifdef EASY_TRANSLATE_UTF16
+#if EASY_TRANSLATE_CPLUSPLUS < 201703L
+#error "The EASY_TRANSLATE_UTF16 requires C++17."
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EASY_TRANSLATE_SSE2
+#endif
+#endif // EASY_TRANSLATE_UTF16
+
+#ifdef EASY_TRANSLATE_ID_REGISTRY
+#if !defined(__ELF__) || !(defined(__GNUC__) || defined(__clang__))
+#error "The EASY_TRANSLATE_ID_REGISTRY requires the ELF platform and GCC or Clang."
+#endif
+// Emit a pointer to the given string literal into the `easytr_ids` section.
+// (inline assembly, since the section attribute conflicts between the inline and non-inline functions)
+#if __SIZEOF_POINTER__ == 8
+#define EASY_TRANSLATE_REGISTER_ID(x) \
+    __asm__ __volatile__(".pushsection easytr_ids,\"aw\"\n\t.balign 8\n\t.quad %c0\n\t.popsection" :: "i"("" x))
+#else
+#define EASY_TRANSLATE_REGISTER_ID(x) \
+    __asm__ __volatile__(".pushsection easytr_ids,\"aw\"\n\t.balign 4\n\t.long %c0\n\t.popsection" :: "i"("" x))
+#endif
+#endif // EASY_TRANSLATE_ID_REGISTRY
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap, munmap
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // close, write
+// The easytr::Bundle is mapped into the memory by the mmap (otherwise it is read into the memory), and the
+// `Translations` can be written to a file descriptor.
+#define EASY_TRANSLATE_POSIX
+#endif
+
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+#ifndef __linux__
+#error "The EASY_TRANSLATE_HOT_RELOAD requires the Linux inotify."
+#endif
+#include <functional>           // function
+#include <fcntl.h>              // O_NONBLOCK, O_CLOEXEC
+#include <poll.h>               // poll
+#include <sys/inotify.h>        // inotify_init1, inotify_add_watch, inotify_rm_watch
+#include <unistd.h>             // pipe2, read, write, close
+#endif // EASY_TRANSLATE_HOT_RELOAD
+
+#if defined(EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES) || defined(EASY_TRANSLATE_ID_REGISTRY)
+// The `Translation ID`s are collected for the easytr::updateTranslationsFiles() function.
+#define EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+#endif
+
 // Translate function
 //   - Usage: EASYTR("Translation ID")
 //   - Get the `Translation text` of the given `Translation ID` on current language.
 //   - If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+#ifndef EASY_TRANSLATE_ID_REGISTRY
 #define EASYTR(x) easytr::translate(x)
+#else
+// The given string literal, that recorded into the registry.
+#define EASY_TRANSLATE_REGISTERED_ID(x) ([]() -> const char* { EASY_TRANSLATE_REGISTER_ID(x); return "" x; }())
+#define EASYTR(x) easytr::translate(EASY_TRANSLATE_REGISTERED_ID(x))
+#endif // !EASY_TRANSLATE_ID_REGISTRY
+
+// Format function
+//   - Usage: EASYTR_FMT("Translation ID", args...)
+//   - Get the `Translation text` of the given `Translation ID` on current language, and replace its placeholders
+//     (e.g. "Downloaded {0} of {1} files", or "{count}" with the easytr::arg("count", value)) with the arguments.
+//   - If the given `Translation ID` is not exist on the current language, format the `Translation ID` itself.
+#ifndef EASY_TRANSLATE_ID_REGISTRY
+#define EASYTR_FMT(x, ...) easytr::format(x, __VA_ARGS__)
+#else
+#define EASYTR_FMT(x, ...) easytr::format(EASY_TRANSLATE_REGISTERED_ID(x), __VA_ARGS__)
+#endif // !EASY_TRANSLATE_ID_REGISTRY
+
+// Plural function
+//   - Usage: EASYTR_PLURAL("Translation ID", n) or EASYTR_FMT_PLURAL("Translation ID", n, args...)
+//   - Get (and format) the plural form of the `Translation text` of the given `Translation ID` on current language,
+//     that is chosen by the count `n` and the plural rule of the current language.
+#ifndef EASY_TRANSLATE_ID_REGISTRY
+#define EASYTR_PLURAL(x, n) easytr::translatePlural(x, n)
+#define EASYTR_FMT_PLURAL(x, n, ...) easytr::formatPlural(x, n, __VA_ARGS__)
+#else
+#define EASYTR_PLURAL(x, n) easytr::translatePlural(EASY_TRANSLATE_REGISTERED_ID(x), n)
+#define EASYTR_FMT_PLURAL(x, n, ...) easytr::formatPlural(EASY_TRANSLATE_REGISTERED_ID(x), n, __VA_ARGS__)
+#endif // !EASY_TRANSLATE_ID_REGISTRY
+
+// Translate function with the length
+//   - Usage: EASYTR_VIEW("Translation ID")
+//   - Like the EASYTR(), but get the `Translation text` with its length as easytr::TextView, it converts to
+//     the std::string_view in C++17.
+#ifndef EASY_TRANSLATE_ID_REGISTRY
+#define EASYTR_VIEW(x) easytr::translateView(x)
+#else
+#define EASYTR_VIEW(x) easytr::translateView(EASY_TRANSLATE_REGISTERED_ID(x))
+#endif // !EASY_TRANSLATE_ID_REGISTRY
+
+// UTF-16 translate function
+//   - Usage: EASYTR_U16("Translation ID")
+//   - Get the UTF-16 `Translation text` of the given `Translation ID` on current language, as std::u16string_view.
+//   - Only available when define the macro \ref EASY_TRANSLATE_UTF16.
+#ifdef EASY_TRANSLATE_UTF16
+#ifndef EASY_TRANSLATE_ID_REGISTRY
+#define EASYTR_U16(x) easytr::translateU16(x)
+#else
+#define EASYTR_U16(x) easytr::translateU16(EASY_TRANSLATE_REGISTERED_ID(x))
+#endif // !EASY_TRANSLATE_ID_REGISTRY
+#endif // EASY_TRANSLATE_UTF16
+
+// Prefetch the memory at the given address into the cache. (no effect on the unsupported compilers)
+#if defined(__GNUC__) || defined(__clang__)
+#define EASY_TRANSLATE_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define EASY_TRANSLATE_PREFETCH(addr) _mm_prefetch(reinterpret_cast<const char*>(addr), _MM_HINT_T0)
+#else
+#define EASY_TRANSLATE_PREFETCH(addr) ((void) (addr))
+#endif
 
 // The following is a sample directory structure and content structure for
 // the `Languages file` and `Translations file`:
@@ -65,410 +240,5420 @@
 namespace easytr
 {
 
-class Languages
+namespace detail
 {
-    friend class TranslateManager;
 
+/// @brief Continue the FNV-1a hash `h` with the given string, so a string can be hashed piece by piece.
+inline uint64_t hash(const char* str, size_t len, uint64_t h)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        h ^= static_cast<unsigned char>(str[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+/// @brief The FNV-1a hash of the given string.
+inline uint64_t hash(const char* str, size_t len) { return hash(str, len, 14695981039346656037ULL); }
+
+/// @brief Get the index of the calling thread, the threads are numbered in the order of the first call.
+inline size_t threadStripe()
+{
+    static std::atomic<size_t> next(0);
+    static thread_local size_t index = next++;
+    return index;
+}
+
+/// @brief Call the `func(i)` for each i in [0, count) on the worker threads.
+/// @param threadCount The number of the worker threads, 0 means the number of the hardware threads.
+template <typename Func>
+inline void parallelFor(size_t count, size_t threadCount, Func func)
+{
+    if (threadCount == 0)
+        threadCount = std::thread::hardware_concurrency();
+    if (threadCount > count)
+        threadCount = count;
+
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+            func(i);
+    };
+
+    if (threadCount <= 1)
+    {
+        work();
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < threadCount; ++i)
+        workers.emplace_back(work);
+    for (auto& worker : workers)
+        worker.join();
+}
+
+#ifdef EASY_TRANSLATE_UTF16
+/// @brief Transcode the UTF-8 string to UTF-16, the invalid sequences are replaced with U+FFFD.
+/// @note Only the runs of ASCII characters are widened 16 bytes at once with SSE2, the multi-byte sequences
+/// are decoded one code point at a time.
+inline std::u16string utf8ToUtf16(const char* data, size_t len)
+{
+    // The UTF-16 code units are never more than the UTF-8 bytes.
+    std::u16string out(len, u'\0');
+    char16_t* dst = &out[0];
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* end = p + len;
+    while (p < end)
+    {
+    #ifdef EASY_TRANSLATE_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        while (end - p >= 16)
+        {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            if (_mm_movemask_epi8(chunk) != 0)
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(chunk, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(chunk, zero));
+            p += 16;
+            dst += 16;
+        }
+        if (p >= end)
+            break;
+    #endif // EASY_TRANSLATE_SSE2
+
+        unsigned char ch = *p;
+        if (ch < 0x80)
+        {
+            *dst++ = ch;
+            ++p;
+            continue;
+        }
+
+        size_t trail;
+        uint32_t cp, min;
+        if ((ch & 0xE0) == 0xC0)
+        {
+            trail = 1;
+            cp = ch & 0x1F;
+            min = 0x80;
+        }
+        else if ((ch & 0xF0) == 0xE0)
+        {
+            trail = 2;
+            cp = ch & 0x0F;
+            min = 0x800;
+        }
+        else if ((ch & 0xF8) == 0xF0)
+        {
+            trail = 3;
+            cp = ch & 0x07;
+            min = 0x10000;
+        }
+        else
+        {
+            *dst++ = 0xFFFD;
+            ++p;
+            continue;
+        }
+
+        size_t i = 1;
+        for (; i <= trail && p + i < end && (p[i] & 0xC0) == 0x80; ++i)
+            cp = (cp << 6) | (p[i] & 0x3F);
+        p += i;
+        if (i <= trail || cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+            *dst++ = 0xFFFD;
+        }
+        else if (cp >= 0x10000)
+        {
+            cp -= 0x10000;
+            *dst++ = static_cast<char16_t>(0xD800 + (cp >> 10));
+            *dst++ = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+        }
+        else
+        {
+            *dst++ = static_cast<char16_t>(cp);
+        }
+    }
+
+    out.resize(static_cast<size_t>(dst - out.data()));
+    return out;
+}
+#endif // EASY_TRANSLATE_UTF16
+
+// A type erased argument of the easytr::format(), it refers to the value without copy.
+struct FormatArg
+{
+    enum Type
+    {
+        INT,
+        UINT,
+        DOUBLE,
+        STRING
+    };
+
+    Type type;
+    // The name of the named argument (see the easytr::arg()), nullptr if it is a positional argument.
+    const char* name = nullptr;
+    size_t nameLen = 0;
+    union
+    {
+        long long i;
+        unsigned long long u;
+        double d;
+        struct
+        {
+            const char* data;
+            size_t size;
+        } str;
+    };
+
+    FormatArg(long long value) : type(INT), i(value) {}
+
+    FormatArg(unsigned long long value) : type(UINT), u(value) {}
+
+    FormatArg(double value) : type(DOUBLE), d(value) {}
+
+    FormatArg(const char* data, size_t size) : type(STRING) { str.data = data; str.size = size; }
+};
+
+// Writes the formatted text to a caller supplied buffer, the overflowed part is only counted.
+class FormatWriter
+{
 public:
-    Languages() = default;
+    FormatWriter(char* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
 
-    Languages(const std::vector<std::pair<std::string, std::string>>& langs)
+    void write(const char* data, size_t len)
     {
-        for (const auto& var : langs)
-            languages_.insert({ var.first, var.second });
+        if (size_ < capacity_)
+            std::memcpy(buffer_ + size_, data, len < capacity_ - size_ ? len : capacity_ - size_);
+        size_ += len;
     }
 
-    Languages(const std::map<std::string, std::string>& langs) : languages_(langs) {}
+    void write(const FormatArg& arg)
+    {
+        char buffer[32];
+        switch (arg.type)
+        {
+            case FormatArg::INT:
+                if (arg.i < 0)
+                {
+                    write("-", 1);
+                    writeUnsigned(0 - static_cast<unsigned long long>(arg.i));
+                }
+                else
+                {
+                    writeUnsigned(static_cast<unsigned long long>(arg.i));
+                }
+                break;
+            case FormatArg::UINT:
+                writeUnsigned(arg.u);
+                break;
+            case FormatArg::DOUBLE:
+            {
+                int len = std::snprintf(buffer, sizeof(buffer), "%g", arg.d);
+                write(buffer, len > 0 ? static_cast<size_t>(len) : 0);
+                break;
+            }
+            default:
+                write(arg.str.data, arg.str.size);
+                break;
+        }
+    }
 
-    /// @brief Load the `Languages` from a json string.
-    /// @note If the json is invalid, the `Languages` will be empty.
-    static Languages fromJson(const std::string& json)
+    /// @brief Get the length of the whole formatted text, include the part that not fit the buffer.
+    size_t size() const { return size_; }
+
+private:
+    void writeUnsigned(unsigned long long value)
     {
-        using Json = nlohmann::json;
+        char buffer[24];
+        char* p = buffer + sizeof(buffer);
+        do
+        {
+            *--p = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        write(p, static_cast<size_t>(buffer + sizeof(buffer) - p));
+    }
 
-        Json j = Json::parse(json, nullptr, false, true);
-        if (j.is_discarded())
-            return Languages();
+    char* buffer_;
+    size_t capacity_;
+    size_t size_ = 0;
+};
 
-        std::map<std::string, std::string> list;
-        for (const auto& var : j.items())
-            list.insert({ var.key(), var.value() });
+// The CLDR plural categories.
+enum PluralCategory : uint8_t
+{
+    PLURAL_ZERO,
+    PLURAL_ONE,
+    PLURAL_TWO,
+    PLURAL_FEW,
+    PLURAL_MANY,
+    PLURAL_OTHER,
+    PLURAL_COUNT
+};
+
+/// @brief Get the name of the plural category, like "one".
+inline const char* pluralCategoryName(size_t category)
+{
+    static const char* const names[PLURAL_COUNT] = { "zero", "one", "two", "few", "many", "other" };
+    return category < PLURAL_COUNT ? names[category] : "";
+}
 
-        return Languages(list);
+/// @brief Get the plural category of the name, if the name is invalid return #PLURAL_COUNT.
+inline PluralCategory pluralCategoryOf(const std::string& name)
+{
+    for (size_t i = 0; i < PLURAL_COUNT; ++i)
+    {
+        if (name == pluralCategoryName(i))
+            return static_cast<PluralCategory>(i);
     }
+    return PLURAL_COUNT;
+}
 
-    /// @brief Load the `Languages` from a json file.
-    /// @note If the json is invalid, the `Languages` will be empty.
-    static Languages fromFile(const std::string& filename)
+// The cardinal plural rules of the CLDR for the integer counts, grouped by the languages that share them.
+typedef PluralCategory (*PluralFunction)(unsigned long long n);
+
+// ja, zh, ko, vi, th, id, ...
+inline PluralCategory pluralNone(unsigned long long)
+{ return PLURAL_OTHER; }
+
+// en, de, nl, sv, da, nb, fi, el, hu, tr, bg, ...
+inline PluralCategory pluralOne(unsigned long long n)
+{ return n == 1 ? PLURAL_ONE : PLURAL_OTHER; }
+
+// es, it, ca
+inline PluralCategory pluralOneMillion(unsigned long long n)
+{ return n == 1 ? PLURAL_ONE : (n != 0 && n % 1000000 == 0 ? PLURAL_MANY : PLURAL_OTHER); }
+
+// fr, pt
+inline PluralCategory pluralZeroOneMillion(unsigned long long n)
+{ return n <= 1 ? PLURAL_ONE : (n % 1000000 == 0 ? PLURAL_MANY : PLURAL_OTHER); }
+
+// hi, bn, fa, hy, ...
+inline PluralCategory pluralZeroOne(unsigned long long n)
+{ return n <= 1 ? PLURAL_ONE : PLURAL_OTHER; }
+
+// ru, uk, be
+inline PluralCategory pluralEastSlavic(unsigned long long n)
+{
+    unsigned long long n10 = n % 10, n100 = n % 100;
+    if (n10 == 1 && n100 != 11)
+        return PLURAL_ONE;
+    if (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14))
+        return PLURAL_FEW;
+    return PLURAL_MANY;
+}
+
+// hr, sr, bs
+inline PluralCategory pluralSouthSlavic(unsigned long long n)
+{
+    unsigned long long n10 = n % 10, n100 = n % 100;
+    if (n10 == 1 && n100 != 11)
+        return PLURAL_ONE;
+    if (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14))
+        return PLURAL_FEW;
+    return PLURAL_OTHER;
+}
+
+// pl
+inline PluralCategory pluralPolish(unsigned long long n)
+{
+    unsigned long long n10 = n % 10, n100 = n % 100;
+    if (n == 1)
+        return PLURAL_ONE;
+    if (n10 >= 2 && n10 <= 4 && (n100 < 12 || n100 > 14))
+        return PLURAL_FEW;
+    return PLURAL_MANY;
+}
+
+// cs, sk
+inline PluralCategory pluralCzech(unsigned long long n)
+{ return n == 1 ? PLURAL_ONE : (n >= 2 && n <= 4 ? PLURAL_FEW : PLURAL_OTHER); }
+
+// lt
+inline PluralCategory pluralLithuanian(unsigned long long n)
+{
+    unsigned long long n10 = n % 10, n100 = n % 100;
+    if (n100 >= 11 && n100 <= 19)
+        return PLURAL_OTHER;
+    return n10 == 1 ? PLURAL_ONE : (n10 >= 2 ? PLURAL_FEW : PLURAL_OTHER);
+}
+
+// lv
+inline PluralCategory pluralLatvian(unsigned long long n)
+{
+    unsigned long long n10 = n % 10, n100 = n % 100;
+    if (n10 == 0 || (n100 >= 11 && n100 <= 19))
+        return PLURAL_ZERO;
+    return n10 == 1 ? PLURAL_ONE : PLURAL_OTHER;
+}
+
+// ro
+inline PluralCategory pluralRomanian(unsigned long long n)
+{
+    unsigned long long n100 = n % 100;
+    if (n == 1)
+        return PLURAL_ONE;
+    return n == 0 || (n100 >= 2 && n100 <= 19) ? PLURAL_FEW : PLURAL_OTHER;
+}
+
+// sl
+inline PluralCategory pluralSlovenian(unsigned long long n)
+{
+    unsigned long long n100 = n % 100;
+    if (n100 == 1)
+        return PLURAL_ONE;
+    if (n100 == 2)
+        return PLURAL_TWO;
+    return n100 == 3 || n100 == 4 ? PLURAL_FEW : PLURAL_OTHER;
+}
+
+// is, mk
+inline PluralCategory pluralIcelandic(unsigned long long n)
+{ return n % 10 == 1 && n % 100 != 11 ? PLURAL_ONE : PLURAL_OTHER; }
+
+// he
+inline PluralCategory pluralHebrew(unsigned long long n)
+{ return n == 1 ? PLURAL_ONE : (n == 2 ? PLURAL_TWO : PLURAL_OTHER); }
+
+// ar
+inline PluralCategory pluralArabic(unsigned long long n)
+{
+    unsigned long long n100 = n % 100;
+    if (n <= 2)
+        return static_cast<PluralCategory>(PLURAL_ZERO + n);
+    if (n100 >= 3 && n100 <= 10)
+        return PLURAL_FEW;
+    return n100 >= 11 ? PLURAL_MANY : PLURAL_OTHER;
+}
+
+// ga
+inline PluralCategory pluralIrish(unsigned long long n)
+{
+    if (n == 1)
+        return PLURAL_ONE;
+    if (n == 2)
+        return PLURAL_TWO;
+    if (n >= 3 && n <= 6)
+        return PLURAL_FEW;
+    return n >= 7 && n <= 10 ? PLURAL_MANY : PLURAL_OTHER;
+}
+
+// cy
+inline PluralCategory pluralWelsh(unsigned long long n)
+{
+    switch (n)
     {
-        using Json = nlohmann::json;
+        case 0: return PLURAL_ZERO;
+        case 1: return PLURAL_ONE;
+        case 2: return PLURAL_TWO;
+        case 3: return PLURAL_FEW;
+        case 6: return PLURAL_MANY;
+        default: return PLURAL_OTHER;
+    }
+}
 
-        std::ifstream ifs(filename);
-        if (!ifs.is_open())
-            return Languages();
+// The plural rule of a language, the categories of the small counts are looked up from a table.
+class PluralRule
+{
+public:
+    static constexpr size_t tableSize = 128;
 
-        Json j = Json::parse(ifs, nullptr, false, true);
-        if (j.is_discarded())
+    explicit PluralRule(PluralFunction function = pluralOne) : function_(function)
+    {
+        for (size_t i = 0; i < tableSize; ++i)
+            table_[i] = function(i);
+    }
+
+    /// @brief Get the plural rule of the language, it is chosen by the primary language subtag of the
+    /// `Language ID` (like "ru" of the "ru_RU" or "ru-RU"), and the rule of English is used if it is unknown.
+    static PluralRule fromLanguageId(const std::string& languageId)
+    {
+        static const struct
         {
-            ifs.close();
-            return Languages();
+            const char* languages;
+            PluralFunction function;
+        } rules[] = {
+            { " ja zh ko vi th id ms lo my km jv su yue bo dz ig kea ses sg to wo yo ", pluralNone },
+            { " es it ca ", pluralOneMillion },
+            { " fr pt ", pluralZeroOneMillion },
+            { " hi bn fa gu kn mr zu am as hy ff kab ", pluralZeroOne },
+            { " ru uk be ", pluralEastSlavic },
+            { " hr sr bs sh ", pluralSouthSlavic },
+            { " pl ", pluralPolish },
+            { " cs sk ", pluralCzech },
+            { " lt ", pluralLithuanian },
+            { " lv ", pluralLatvian },
+            { " ro mo ", pluralRomanian },
+            { " sl ", pluralSlovenian },
+            { " is mk ", pluralIcelandic },
+            { " he iw ", pluralHebrew },
+            { " ar ", pluralArabic },
+            { " ga ", pluralIrish },
+            { " cy ", pluralWelsh }
+        };
+
+        std::string language = " ";
+        for (char ch : languageId)
+        {
+            if (ch == '_' || ch == '-' || ch == '.' || ch == '@')
+                break;
+            language.push_back(ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch);
         }
+        language.push_back(' ');
 
-        std::map<std::string, std::string> list;
-        ifs.close();
-        for (const auto& var : j.items())
-            list.insert({ var.key(), var.value() });
+        for (const auto& rule : rules)
+        {
+            if (language.size() > 2 && std::strstr(rule.languages, language.c_str()))
+                return PluralRule(rule.function);
+        }
+        return PluralRule();
+    }
+
+    /// @brief Get the plural category of the count.
+    PluralCategory select(unsigned long long n) const
+    { return n < tableSize ? static_cast<PluralCategory>(table_[n]) : function_(n); }
+
+private:
+    PluralFunction function_;
+    uint8_t table_[tableSize];
+};
+
+// The compiled message pattern of a `Translation text`, it is parsed only once when the text is loaded.
+//
+// The message pattern is a subset of the ICU MessageFormat:
+//   - `{index}` and `{name}` are the positional and named arguments.
+//   - `{arg, select, key {message} ... other {message}}` chooses the sub-message by the argument.
+//   - `{arg, plural, [offset:N] =N {message} category {message} ... other {message}}` chooses the sub-message
+//     by the number of the argument, the exact matches (`=N`) take precedence over the plural categories.
+//     The `#` in the sub-message is the number minus the offset.
+//   - The `{{` and `}}` are the escaped `{` and `}`, but the `}` always closes the sub-message in it.
+//   - The placeholder that can not be parsed is treated as literal text.
+//
+// The pattern is compiled to a bytecode of 32-bit words, it refers to the ranges of the pattern:
+//   OP_TEXT     offset len
+//   OP_ARG      index nameOffset nameLen rawOffset rawLen
+//   OP_SELECT   index nameOffset nameLen end, and the cases {keyOffset keyLen next, sub-message, OP_JUMP end}
+//   OP_PLURAL   index nameOffset nameLen offset end, and the cases {key value next, sub-message, OP_JUMP end}
+//   OP_NUMBER   index nameOffset nameLen offset
+//   OP_JUMP     target
+// The `index` is the #NAMED for the named argument, the `next` of the last case is 0, and the `key` of the
+// plural case is the PluralCategory or the #EXACT.
+class Message
+{
+public:
+    /// @brief Compile the message pattern, if it has no brace return nullptr (it is the literal text).
+    static std::shared_ptr<const Message> compile(const char* pattern, size_t len)
+    {
+        if (!std::memchr(pattern, '{', len) && !std::memchr(pattern, '}', len))
+            return nullptr;
 
-        return Languages(list);
+        std::shared_ptr<Message> message = std::make_shared<Message>();
+        compileTo(pattern, len, message->code_);
+        message->code_.shrink_to_fit();
+        return message;
     }
 
-    /// @brief Get the json string.
-    std::string toJson() const
+    static std::shared_ptr<const Message> compile(const std::string& pattern)
+    { return compile(pattern.c_str(), pattern.size()); }
+
+    /// @brief Compile the message pattern to the bytecode, it replaces the content of the `code`.
+    static void compileTo(const char* pattern, size_t len, std::vector<uint32_t>& code)
     {
-        nlohmann::json j;
-        for (const auto& var : languages_)
-            j[var.first] = var.second;
-        return j.dump(4);
+        code.clear();
+        Compiler compiler{ pattern, len, code };
+        size_t pos = 0;
+        compiler.message(pos, 0, nullptr);
     }
 
-    /// @brief Write the `Languages` to a json file.
-    /// @return If the failed to write the file return false else return true.
-    bool toFile(const std::string& filename = "languages.json") const
+    /// @brief Format the compiled `pattern` with the arguments, the `rule` chooses the plural categories.
+    void format(const char* pattern, const FormatArg* args, size_t count, const PluralRule& rule,
+                FormatWriter& writer) const
+    { run(code_.data(), code_.size(), pattern, args, count, rule, writer); }
+
+    /// @brief Format the `pattern` with its bytecode that compiled by the #compileTo(). (see the #format())
+    static void run(const uint32_t* code, size_t size, const char* pattern, const FormatArg* args, size_t count,
+                    const PluralRule& rule, FormatWriter& writer)
     {
-        std::ofstream ofs(filename);
-        if (!ofs.is_open())
-            return false;
-        ofs << toJson();
-        ofs.close();
-        return true;
+        size_t pc = 0;
+        while (pc < size)
+        {
+            switch (code[pc])
+            {
+                case OP_TEXT:
+                    writer.write(pattern + code[pc + 1], code[pc + 2]);
+                    pc += 3;
+                    break;
+                case OP_ARG:
+                {
+                    const FormatArg* arg = findArg(pattern, code + pc + 1, args, count);
+                    if (arg)
+                        writer.write(*arg);
+                    else
+                        writer.write(pattern + code[pc + 4], code[pc + 5]);
+                    pc += 6;
+                    break;
+                }
+                case OP_SELECT:
+                    pc = select(code, pattern, pc, findArg(pattern, code + pc + 1, args, count));
+                    break;
+                case OP_PLURAL:
+                    pc = plural(code, pc, findArg(pattern, code + pc + 1, args, count), rule);
+                    break;
+                case OP_NUMBER:
+                {
+                    const FormatArg* arg = findArg(pattern, code + pc + 1, args, count);
+                    if (arg)
+                        writer.write(subtract(*arg, static_cast<int32_t>(code[pc + 4])));
+                    pc += 5;
+                    break;
+                }
+                default: // OP_JUMP
+                    pc = code[pc + 1];
+                    break;
+            }
+        }
     }
 
-    /// @brief Get the `Translations filename` of the given `Language ID`.
-    const char* at(const std::string& languageId) const
-    { return languages_.at(languageId).c_str(); }
+private:
+    enum Op : uint32_t
+    {
+        OP_TEXT,
+        OP_ARG,
+        OP_SELECT,
+        OP_PLURAL,
+        OP_NUMBER,
+        OP_JUMP
+    };
 
-    /// @brief Get the number of the `Language ID`.
-    size_t count() const { return languages_.size(); }
+    // The `index` of the named argument.
+    static constexpr uint32_t NAMED = 0xFFFFFFFF;
+    // The `key` of the plural case that matches the exact number.
+    static constexpr uint32_t EXACT = PLURAL_COUNT;
 
-    /// @brief Check whether has not any `Language ID`.
-    bool empty() const { return count() == 0; }
+    struct Compiler
+    {
+        static constexpr int maxDepth = 16;
+
+        const char* pattern;
+        size_t len;
+        std::vector<uint32_t>& code;
+
+        void emit(std::initializer_list<size_t> words)
+        {
+            for (size_t word : words)
+                code.push_back(static_cast<uint32_t>(word));
+        }
+
+        void text(size_t begin, size_t end)
+        {
+            if (end > begin)
+                emit({ OP_TEXT, begin, end - begin });
+        }
+
+        void skipSpaces(size_t& pos) const
+        {
+            while (pos < len && (pattern[pos] == ' ' || pattern[pos] == '\t' || pattern[pos] == '\n' ||
+                                 pattern[pos] == '\r'))
+                ++pos;
+        }
+
+        // The characters of the argument names and the keys, include the non-ASCII characters.
+        static bool isNameChar(char ch)
+        {
+            return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') ||
+                   ch == '_' || ch == '-' || static_cast<unsigned char>(ch) >= 0x80;
+        }
+
+        size_t name(size_t& pos) const
+        {
+            size_t begin = pos;
+            while (pos < len && isNameChar(pattern[pos]))
+                ++pos;
+            return pos - begin;
+        }
+
+        bool keyword(size_t begin, size_t size, const char* word) const
+        { return size == std::strlen(word) && std::memcmp(pattern + begin, word, size) == 0; }
+
+        /// @brief Parse the integer of at most 9 digits, with an optional minus sign.
+        bool integer(size_t& pos, int32_t& value) const
+        {
+            bool negative = pos < len && pattern[pos] == '-';
+            size_t begin = negative ? ++pos : pos;
+            value = 0;
+            while (pos < len && pattern[pos] >= '0' && pattern[pos] <= '9' && pos - begin < 9)
+                value = value * 10 + (pattern[pos++] - '0');
+            if (pos == begin || (pos < len && pattern[pos] >= '0' && pattern[pos] <= '9'))
+                return false;
+            value = negative ? -value : value;
+            return true;
+        }
+
+        /// @brief Parse the argument name, it is the index of the positional argument if it is all digits.
+        bool argument(size_t& pos, uint32_t (&ref)[3]) const
+        {
+            skipSpaces(pos);
+            size_t begin = pos;
+            size_t size = name(pos);
+            if (size == 0)
+                return false;
+
+            bool numeric = size <= 9;
+            uint32_t index = 0;
+            for (size_t i = begin; numeric && i < pos; ++i)
+            {
+                numeric = pattern[i] >= '0' && pattern[i] <= '9';
+                index = index * 10 + static_cast<uint32_t>(pattern[i] - '0');
+            }
+            ref[0] = numeric ? index : NAMED;
+            ref[1] = static_cast<uint32_t>(begin);
+            ref[2] = static_cast<uint32_t>(size);
+            return true;
+        }
+
+        /// @brief Compile the message until the end of the pattern, or the `}` that closes the sub-message if
+        /// the `depth` > 0. The `number` is the argument and offset of the innermost plural, the `#` refers to it.
+        void message(size_t& pos, int depth, const uint32_t* number)
+        {
+            size_t literal = pos;
+            while (pos < len)
+            {
+                char ch = pattern[pos];
+                if (ch == '{' || (ch == '}' && depth == 0))
+                {
+                    // The escaped brace, output the literal text include the first brace.
+                    if (pos + 1 < len && pattern[pos + 1] == ch)
+                    {
+                        text(literal, pos + 1);
+                        pos += 2;
+                        literal = pos;
+                        continue;
+                    }
+                    if (ch == '}')
+                    {
+                        ++pos;
+                        continue;
+                    }
+
+                    size_t mark = code.size();
+                    size_t begin = pos;
+                    text(literal, pos);
+                    if (placeholder(pos, depth, number))
+                    {
+                        literal = pos;
+                    }
+                    else
+                    {
+                        code.resize(mark);
+                        pos = begin + 1;
+                    }
+                    continue;
+                }
+
+                if (ch == '}')
+                    break;
+
+                if (ch == '#' && number)
+                {
+                    text(literal, pos);
+                    emit({ OP_NUMBER, number[0], number[1], number[2], number[3] });
+                    literal = ++pos;
+                    continue;
+                }
+                ++pos;
+            }
+            text(literal, pos);
+        }
+
+        bool placeholder(size_t& pos, int depth, const uint32_t* number)
+        {
+            size_t begin = pos++;
+            uint32_t ref[3];
+            if (!argument(pos, ref))
+                return false;
+
+            skipSpaces(pos);
+            if (pos < len && pattern[pos] == ',')
+            {
+                ++pos;
+                skipSpaces(pos);
+                size_t type = pos;
+                size_t size = name(pos);
+                bool isSelect = keyword(type, size, "select");
+                bool isPlural = keyword(type, size, "plural");
+                skipSpaces(pos);
+                if (isSelect || isPlural)
+                {
+                    if (depth >= maxDepth || pos >= len || pattern[pos] != ',')
+                        return false;
+                    ++pos;
+                    return cases(pos, depth, number, ref, isPlural);
+                }
+
+                // The other types (like `{0, number}`) are formatted as the plain argument.
+                while (pos < len && pattern[pos] != '}' && pattern[pos] != '{')
+                    ++pos;
+            }
+
+            if (pos >= len || pattern[pos] != '}')
+                return false;
+            ++pos;
+            emit({ OP_ARG, ref[0], ref[1], ref[2], begin, pos - begin });
+            return true;
+        }
+
+        bool cases(size_t& pos, int depth, const uint32_t* number, const uint32_t (&ref)[3], bool isPlural)
+        {
+            size_t head = code.size();
+            int32_t offset = 0;
+            if (isPlural)
+            {
+                skipSpaces(pos);
+                if (len - pos > 7 && std::memcmp(pattern + pos, "offset:", 7) == 0)
+                {
+                    pos += 7;
+                    skipSpaces(pos);
+                    if (!integer(pos, offset))
+                        return false;
+                }
+                emit({ OP_PLURAL, ref[0], ref[1], ref[2], static_cast<uint32_t>(offset), 0 });
+            }
+            else
+            {
+                emit({ OP_SELECT, ref[0], ref[1], ref[2], 0 });
+            }
+
+            // The `#` in the sub-messages of the plural refers to it.
+            const uint32_t plural[4] = { ref[0], ref[1], ref[2], static_cast<uint32_t>(offset) };
+            // The jumps to the end are chained by their targets until the end is known, without allocation.
+            size_t jumps = 0;
+            size_t next = 0;
+            while (true)
+            {
+                skipSpaces(pos);
+                if (pos >= len)
+                    return false;
+                if (pattern[pos] == '}')
+                    break;
+
+                uint32_t key[2];
+                if (isPlural && pattern[pos] == '=')
+                {
+                    int32_t value;
+                    if (!integer(++pos, value))
+                        return false;
+                    key[0] = EXACT;
+                    key[1] = static_cast<uint32_t>(value);
+                }
+                else
+                {
+                    size_t begin = pos;
+                    size_t size = name(pos);
+                    if (size == 0)
+                        return false;
+                    key[0] = static_cast<uint32_t>(begin);
+                    key[1] = static_cast<uint32_t>(size);
+                    if (isPlural)
+                    {
+                        key[0] = pluralCategoryOf(std::string(pattern + begin, size));
+                        if (key[0] == PLURAL_COUNT)
+                            return false;
+                    }
+                }
+
+                skipSpaces(pos);
+                if (pos >= len || pattern[pos] != '{')
+                    return false;
+                ++pos;
+
+                if (next)
+                    code[next] = static_cast<uint32_t>(code.size());
+                emit({ key[0], key[1], 0 });
+                next = code.size() - 1;
+
+                message(pos, depth + 1, isPlural ? plural : number);
+                if (pos >= len)
+                    return false;
+                ++pos;
+                emit({ OP_JUMP, jumps });
+                jumps = code.size() - 1;
+            }
+            ++pos;
+
+            if (!next)
+                return false;
+            code[head + (isPlural ? 5 : 4)] = static_cast<uint32_t>(code.size());
+            while (jumps != 0)
+            {
+                size_t previous = code[jumps];
+                code[jumps] = static_cast<uint32_t>(code.size());
+                jumps = previous;
+            }
+            return true;
+        }
+    };
+
+    static const FormatArg* findArg(const char* pattern, const uint32_t* ref, const FormatArg* args, size_t count)
+    {
+        if (ref[0] != NAMED)
+            return ref[0] < count ? &args[ref[0]] : nullptr;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (args[i].name && args[i].nameLen == ref[2] && std::memcmp(args[i].name, pattern + ref[1], ref[2]) == 0)
+                return &args[i];
+        }
+        return nullptr;
+    }
+
+    /// @brief Get the argument minus the offset, the string argument is not changed.
+    static FormatArg subtract(const FormatArg& arg, int32_t offset)
+    {
+        switch (arg.type)
+        {
+            case FormatArg::INT:
+                return FormatArg(arg.i - offset);
+            case FormatArg::UINT:
+                if (offset <= 0 || arg.u >= static_cast<unsigned long long>(offset))
+                    return FormatArg(arg.u - static_cast<unsigned long long>(static_cast<long long>(offset)));
+                return FormatArg(static_cast<long long>(arg.u) - offset);
+            case FormatArg::DOUBLE:
+                return FormatArg(arg.d - offset);
+            default:
+                return arg;
+        }
+    }
+
+    /// @brief Get the position of the sub-message of the select that matches the argument.
+    static size_t select(const uint32_t* code, const char* pattern, size_t pc, const FormatArg* arg)
+    {
+        char buffer[32];
+        const char* value = nullptr;
+        size_t size = 0;
+        if (arg && arg->type == FormatArg::STRING)
+        {
+            value = arg->str.data;
+            size = arg->str.size;
+        }
+        else if (arg)
+        {
+            FormatWriter writer(buffer, sizeof(buffer));
+            writer.write(*arg);
+            value = buffer;
+            size = writer.size() < sizeof(buffer) ? writer.size() : sizeof(buffer);
+        }
+
+        size_t other = code[pc + 4];
+        for (size_t c = pc + 5; c != 0; c = code[c + 2])
+        {
+            const char* key = pattern + code[c];
+            if (value && code[c + 1] == size && std::memcmp(key, value, size) == 0)
+                return c + 3;
+            if (code[c + 1] == 5 && std::memcmp(key, "other", 5) == 0)
+                other = c + 3;
+        }
+        return other;
+    }
+
+    /// @brief Get the position of the sub-message of the plural that matches the number of the argument.
+    static size_t plural(const uint32_t* code, size_t pc, const FormatArg* arg, const PluralRule& rule)
+    {
+        bool isNumber = arg && arg->type != FormatArg::STRING;
+        uint32_t category = PLURAL_OTHER;
+        if (isNumber)
+        {
+            FormatArg n = subtract(*arg, static_cast<int32_t>(code[pc + 4]));
+            if (n.type == FormatArg::INT)
+                category = rule.select(n.i < 0 ? 0 - static_cast<unsigned long long>(n.i) : n.i);
+            else if (n.type == FormatArg::UINT)
+                category = rule.select(n.u);
+            else if (n.d == static_cast<double>(static_cast<long long>(n.d)))
+                category = rule.select(static_cast<unsigned long long>(n.d < 0 ? -n.d : n.d));
+        }
+
+        size_t matched = 0;
+        size_t other = code[pc + 5];
+        for (size_t c = pc + 6; c != 0; c = code[c + 2])
+        {
+            if (code[c] == EXACT)
+            {
+                if (isNumber && equals(*arg, static_cast<int32_t>(code[c + 1])))
+                    return c + 3;
+            }
+            else if (code[c] == category && !matched)
+            {
+                matched = c + 3;
+            }
+            if (code[c] == PLURAL_OTHER)
+                other = c + 3;
+        }
+        return matched ? matched : other;
+    }
+
+    static bool equals(const FormatArg& arg, int32_t value)
+    {
+        switch (arg.type)
+        {
+            case FormatArg::INT:
+                return arg.i == value;
+            case FormatArg::UINT:
+                return value >= 0 && arg.u == static_cast<unsigned long long>(value);
+            default:
+                return arg.d == value;
+        }
+    }
+
+    std::vector<uint32_t> code_;
+};
+
+/// @brief Format the message pattern without keep its compiled form. (used for the `Translation ID` that not exists)
+/// @note The bytecode is compiled to a buffer that reused by the thread, so it does not allocate after the first
+/// calls of the thread.
+inline void formatMessage(const char* pattern, size_t len, const FormatArg* args, size_t count,
+                          const PluralRule& rule, FormatWriter& writer)
+{
+    if (!std::memchr(pattern, '{', len) && !std::memchr(pattern, '}', len))
+    {
+        writer.write(pattern, len);
+        return;
+    }
+
+    static thread_local std::vector<uint32_t> code;
+    Message::compileTo(pattern, len, code);
+    Message::run(code.data(), code.size(), pattern, args, count, rule, writer);
+}
+
+struct Plural;
+
+// The `Translation text` and its compiled form.
+struct Entry
+{
+    std::string text;
+    // The compiled message pattern of the #text, nullptr if the #text has no placeholder.
+    std::shared_ptr<const Message> message;
+    // The plural forms, nullptr if the `Translation text` has not plural forms.
+    std::shared_ptr<const Plural> plural;
+#ifdef EASY_TRANSLATE_UTF16
+    // The UTF-16 #text.
+    std::u16string text16;
+#endif // EASY_TRANSLATE_UTF16
+
+    Entry() = default;
+
+#ifndef EASY_TRANSLATE_UTF16
+    Entry(std::string text) : text(std::move(text)), message(Message::compile(this->text)) {}
+#else
+    Entry(std::string text)
+        : text(std::move(text)), message(Message::compile(this->text)),
+        text16(utf8ToUtf16(this->text.data(), this->text.size()))
+    {}
+#endif // !EASY_TRANSLATE_UTF16
+
+    Entry(const char* text) : Entry(std::string(text)) {}
+
+    /// @brief Make the entry of the plural forms {Plural category name : Translation text}, the #text is the
+    /// "other" form. The forms that not given fall back to the "other" form.
+    /// @note The invalid plural category names are ignored, if there is not any valid one, the entry is empty.
+    static Entry fromPluralForms(const std::map<std::string, std::string>& forms);
+};
+
+// The plural forms of a `Translation text`, they are stored adjacently and indexed by the plural category.
+struct Plural
+{
+    Entry forms[PLURAL_COUNT];
+    // The bit mask of the plural categories that given by the `Translations`.
+    uint8_t given = 0;
+};
+
+inline Entry Entry::fromPluralForms(const std::map<std::string, std::string>& forms)
+{
+    std::shared_ptr<Plural> plural = std::make_shared<Plural>();
+    for (const auto& var : forms)
+    {
+        PluralCategory category = pluralCategoryOf(var.first);
+        if (category != PLURAL_COUNT)
+        {
+            plural->forms[category] = Entry(var.second);
+            plural->given |= static_cast<uint8_t>(1u << category);
+        }
+    }
+    if (plural->given == 0)
+        return Entry();
+
+    // Fall back to the "other" form, or the first given form if the "other" form is not given either.
+    size_t fallback = PLURAL_OTHER;
+    while (!(plural->given & (1u << fallback)))
+        fallback = (fallback + 1) % PLURAL_COUNT;
+    for (size_t i = 0; i < PLURAL_COUNT; ++i)
+    {
+        if (!(plural->given & (1u << i)))
+            plural->forms[i] = plural->forms[fallback];
+    }
+
+    Entry entry = plural->forms[PLURAL_OTHER];
+    entry.plural = std::move(plural);
+    return entry;
+}
+
+/// @brief Make the entry from the json value, the string is the `Translation text` and the object is the
+/// plural forms. (see the Entry::fromPluralForms())
+/// @return If the json value is neither of them return false.
+inline bool entryFromJson(const nlohmann::json& value, Entry& entry)
+{
+    if (value.is_string())
+    {
+        entry = Entry(value.get<std::string>());
+        return true;
+    }
+
+    if (value.is_object())
+    {
+        std::map<std::string, std::string> forms;
+        for (const auto& var : value.items())
+        {
+            if (var.value().is_string())
+                forms.insert({ var.key(), var.value().get<std::string>() });
+        }
+        entry = Entry::fromPluralForms(forms);
+        return entry.plural != nullptr;
+    }
+
+    return false;
+}
+
+/// @brief Check whether the json value is the plural forms, it is an object whose keys are all the plural
+/// category names, otherwise an object is a namespace of the `Translation ID`s.
+/// @note So a namespace whose names are all the plural category names can not be nested, its `Translation ID`s
+/// are written dotted instead. (e.g. {"Dialog.one": "...", "Dialog.other": "..."}, see the nestJson())
+inline bool isPluralForms(const nlohmann::json& value)
+{
+    if (!value.is_object() || value.empty())
+        return false;
+    for (const auto& var : value.items())
+    {
+        if (pluralCategoryOf(var.key()) == PLURAL_COUNT)
+            return false;
+    }
+    return true;
+}
+
+/// @brief Call the `func(Translation ID, json value)` for each `Translation text` of the json object, the
+/// nested objects are the namespaces that flattened to the dotted `Translation ID`s.
+/// (e.g. {"App": {"Menu": {"Open": "Open"}}} is {"App.Menu.Open": "Open"})
+template <typename Func>
+inline void forEachJsonEntry(const nlohmann::json& j, const std::string& prefix, Func& func)
+{
+    for (const auto& var : j.items())
+    {
+        if (var.value().is_object() && !isPluralForms(var.value()))
+            forEachJsonEntry(var.value(), prefix + var.key() + ".", func);
+        else
+            func(prefix + var.key(), var.value());
+    }
+}
+
+/// @brief Load a manifest file of the split `Translations`, see the Languages::addManifest().
+/// @return {Namespace : Translations filename}, the relative filenames are resolved against the directory
+/// of the manifest file. If the file is invalid, return empty.
+inline std::map<std::string, std::string> readManifest(const std::string& filename)
+{
+    std::map<std::string, std::string> files;
+    std::ifstream ifs(filename);
+    if (!ifs.is_open())
+        return files;
+
+    nlohmann::json j = nlohmann::json::parse(ifs, nullptr, false, true);
+    ifs.close();
+    if (!j.is_object())
+        return files;
+
+    size_t slash = filename.find_last_of("/\\");
+    std::string dir = slash == std::string::npos ? std::string() : filename.substr(0, slash + 1);
+    for (const auto& var : j.items())
+    {
+        if (!var.value().is_string())
+            continue;
+        std::string file = var.value().get<std::string>();
+        bool absolute = !file.empty() && (file[0] == '/' || file[0] == '\\' || (file.size() > 1 && file[1] == ':'));
+        files.insert({ var.key(), absolute ? file : dir + file });
+    }
+    return files;
+}
+
+/// @brief Get the length of the namespace of the split `Translations` that the `Translation ID` belongs to,
+/// it is the first segment of the `Translation ID`, 0 if the `Translation ID` has not any '.'.
+inline size_t splitNamespaceLength(const char* tranId, size_t len)
+{
+    const void* dot = std::memchr(tranId, '.', len);
+    return dot ? static_cast<size_t>(static_cast<const char*>(dot) - tranId) : 0;
+}
+
+/// @brief Split the `Translation ID`s to the files of a manifest, see the readManifest().
+/// @return {Namespace : Translation IDs}, it has all namespaces of the manifest. The `Translation ID`s omit the
+/// namespace, the ones whose namespace is not listed are in the empty namespace with the whole `Translation ID`.
+inline std::map<std::string, std::set<std::string>> splitTranslationIds(const std::map<std::string, std::string>& manifest,
+                                                                       const std::set<std::string>& tranIds)
+{
+    std::map<std::string, std::set<std::string>> ids;
+    for (const auto& file : manifest)
+        ids[file.first];
+    for (const auto& tranId : tranIds)
+    {
+        size_t len = splitNamespaceLength(tranId.c_str(), tranId.size());
+        auto it = len > 0 ? ids.find(tranId.substr(0, len)) : ids.end();
+        if (it != ids.end())
+            it->second.insert(tranId.substr(len + 1));
+        else
+            ids[std::string()].insert(tranId);
+    }
+    return ids;
+}
+
+/// @brief Get the nested json object of the {Translation ID : json value}, the reverse of the forEachJsonEntry().
+/// @note - If a namespace is also a `Translation ID`, the `Translation ID`s in it are kept dotted.
+/// @note - If all names in a namespace are the plural category names, the `Translation ID`s in it are kept
+/// dotted, since its object would be read back as the plural forms. (see the isPluralForms())
+inline nlohmann::json nestJson(const std::map<std::string, nlohmann::json>& entries)
+{
+    // {Namespace : whether all names in it are the plural category names}
+    std::map<std::string, bool> categoryNames;
+    for (const auto& var : entries)
+    {
+        for (size_t dot = var.first.find('.'); dot != std::string::npos; dot = var.first.find('.', dot + 1))
+        {
+            size_t end = std::min(var.first.find('.', dot + 1), var.first.size());
+            auto it = categoryNames.insert({ var.first.substr(0, dot), true }).first;
+            it->second = it->second && pluralCategoryOf(var.first.substr(dot + 1, end - dot - 1)) != PLURAL_COUNT;
+        }
+    }
+
+    nlohmann::json j = nlohmann::json::object();
+    for (const auto& var : entries)
+    {
+        nlohmann::json* node = &j;
+        size_t begin = 0;
+        for (size_t dot = var.first.find('.'); dot != std::string::npos; dot = var.first.find('.', begin))
+        {
+            if (categoryNames[var.first.substr(0, dot)])
+                break;
+            nlohmann::json& child = (*node)[var.first.substr(begin, dot - begin)];
+            if (!child.is_null() && (!child.is_object() || isPluralForms(child)))
+                break;
+            if (child.is_null())
+                child = nlohmann::json::object();
+            node = &child;
+            begin = dot + 1;
+        }
+        (*node)[var.first.substr(begin)] = var.second;
+    }
+    return j;
+}
+
+/// @brief Check whether the json of a `Translations file` is nested, it has a namespace object.
+/// (see the forEachJsonEntry())
+inline bool isNestedJson(const nlohmann::json& j)
+{
+    for (const auto& var : j.items())
+    {
+        if (var.value().is_object() && !isPluralForms(var.value()))
+            return true;
+    }
+    return false;
+}
+
+/// @brief Get the json of a `Translations file` that has the {Translation ID : json value}, it is nested
+/// (see the nestJson()) if `nested`, otherwise it has the dotted `Translation ID`s.
+inline nlohmann::json entriesToJson(const std::map<std::string, nlohmann::json>& entries, bool nested)
+{
+    if (nested)
+        return nestJson(entries);
+
+    nlohmann::json j = nlohmann::json::object();
+    for (const auto& var : entries)
+        j[var.first] = var.second;
+    return j;
+}
+
+/// @brief Get the json value of the entry, see the entryFromJson().
+inline nlohmann::json entryToJson(const Entry& entry)
+{
+    if (!entry.plural)
+        return entry.text;
+
+    nlohmann::json j = nlohmann::json::object();
+    for (size_t i = 0; i < PLURAL_COUNT; ++i)
+    {
+        if (entry.plural->given & (1u << i))
+            j[pluralCategoryName(i)] = entry.plural->forms[i].text;
+    }
+    return j;
+}
+
+// Writes the json formatted like the nlohmann::json::dump(4) without building the json, the keys are written
+// in the given order. The output is buffered and flushed to a stream or a file descriptor when the buffer is
+// full, or appended to a string directly.
+class JsonWriter
+{
+public:
+    /// @brief Append to the end of the string.
+    explicit JsonWriter(std::string& out) : out_(&out) {}
+
+    explicit JsonWriter(std::ostream& stream) : out_(&buffer_), stream_(&stream) { buffer_.reserve(BUFFER_SIZE); }
+
+#ifdef EASY_TRANSLATE_POSIX
+    explicit JsonWriter(int fd) : out_(&buffer_), fd_(fd) { buffer_.reserve(BUFFER_SIZE); }
+#endif // EASY_TRANSLATE_POSIX
+
+    ~JsonWriter() { flush(); }
+
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+
+    void beginObject()
+    {
+        out_->push_back('{');
+        empty_.push_back(true);
+    }
+
+    void endObject()
+    {
+        bool empty = empty_.back();
+        empty_.pop_back();
+        if (!empty)
+            newLine();
+        out_->push_back('}');
+        flushIfFull();
+    }
+
+    /// @brief Write the key of the current object, that is the concatenation of the two parts.
+    /// (e.g. the namespace and name of a `Translation ID`)
+    void key(const std::string& first, const std::string& second = std::string())
+    {
+        if (!empty_.back())
+            out_->push_back(',');
+        empty_.back() = false;
+        newLine();
+        out_->push_back('"');
+        escape(first);
+        escape(second);
+        out_->append("\": ");
+    }
+
+    void value(const std::string& str)
+    {
+        out_->push_back('"');
+        escape(str);
+        out_->push_back('"');
+        flushIfFull();
+    }
+
+    /// @brief Write the buffered output to the stream or file descriptor.
+    /// @return If failed to write return false else return true, the later writes fail as well.
+    bool flush()
+    {
+        if (out_ == &buffer_ && !buffer_.empty() && ok_)
+        {
+            if (stream_)
+            {
+                ok_ = static_cast<bool>(stream_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size())));
+            }
+#ifdef EASY_TRANSLATE_POSIX
+            else
+            {
+                for (size_t written = 0; ok_ && written < buffer_.size();)
+                {
+                    ssize_t n = ::write(fd_, buffer_.data() + written, buffer_.size() - written);
+                    if (n > 0)
+                        written += static_cast<size_t>(n);
+                    else if (n < 0 && errno != EINTR)
+                        ok_ = false;
+                }
+            }
+#endif // EASY_TRANSLATE_POSIX
+        }
+        buffer_.clear();
+        return ok_;
+    }
+
+private:
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    void flushIfFull()
+    {
+        if (out_ == &buffer_ && buffer_.size() >= BUFFER_SIZE)
+            flush();
+    }
+
+    void newLine()
+    {
+        out_->push_back('\n');
+        out_->append(empty_.size() * 4, ' ');
+    }
+
+    /// @brief Get the length of the valid UTF-8 sequence at the given position, or the negative length of its
+    /// longest valid prefix (at least 1 byte) if it is invalid.
+    static int utf8Sequence(const std::string& str, size_t pos)
+    {
+        unsigned char c = static_cast<unsigned char>(str[pos]);
+        int length;
+        unsigned char low = 0x80, high = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF)
+            length = 2;
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            length = 3;
+            low = c == 0xE0 ? 0xA0 : 0x80;
+            high = c == 0xED ? 0x9F : 0xBF;
+        }
+        else if (c >= 0xF0 && c <= 0xF4)
+        {
+            length = 4;
+            low = c == 0xF0 ? 0x90 : 0x80;
+            high = c == 0xF4 ? 0x8F : 0xBF;
+        }
+        else
+            return -1;
+
+        for (int i = 1; i < length; ++i)
+        {
+            // Only the second byte has the narrower range.
+            unsigned char next = pos + i < str.size() ? static_cast<unsigned char>(str[pos + i]) : 0;
+            if (next < (i == 1 ? low : 0x80) || next > (i == 1 ? high : 0xBF))
+                return -i;
+        }
+        return length;
+    }
+
+    /// @brief Write the string with the escaped '"', '\\' and control characters, the others are written as is.
+    /// @note The invalid UTF-8 sequences are replaced with U+FFFD, like the nlohmann::json::dump() with the
+    /// error_handler_t::replace, so the written json is always readable.
+    void escape(const std::string& str)
+    {
+        static const char hex[] = "0123456789abcdef";
+        size_t begin = 0;
+        for (size_t i = 0; i < str.size(); ++i)
+        {
+            unsigned char c = static_cast<unsigned char>(str[i]);
+            if (c >= 0x80)
+            {
+                int length = utf8Sequence(str, i);
+                if (length > 0)
+                {
+                    i += length - 1;
+                    continue;
+                }
+                out_->append(str, begin, i - begin);
+                out_->append("\xEF\xBF\xBD");
+                i += -length - 1;
+                begin = i + 1;
+                continue;
+            }
+            if (c >= 0x20 && c != '"' && c != '\\')
+                continue;
+
+            out_->append(str, begin, i - begin);
+            begin = i + 1;
+            out_->push_back('\\');
+            switch (c)
+            {
+                case '"':   out_->push_back('"'); break;
+                case '\\':  out_->push_back('\\'); break;
+                case '\b':  out_->push_back('b'); break;
+                case '\f':  out_->push_back('f'); break;
+                case '\n':  out_->push_back('n'); break;
+                case '\r':  out_->push_back('r'); break;
+                case '\t':  out_->push_back('t'); break;
+                default:
+                    out_->append("u00");
+                    out_->push_back(hex[c >> 4]);
+                    out_->push_back(hex[c & 0xF]);
+                    break;
+            }
+        }
+        out_->append(str, begin, std::string::npos);
+    }
+
+    // The #buffer_ or the string that written to directly.
+    std::string* out_;
+    std::string buffer_;
+    std::ostream* stream_ = nullptr;
+    int fd_ = -1;
+    bool ok_ = true;
+    // Whether the objects that not ended are empty, the last is the innermost.
+    std::vector<bool> empty_;
+};
+
+/// @brief Write the `Translation text` or the plural forms of an entry, like the #entryToJson().
+inline void writeEntryJson(JsonWriter& writer, const Entry& entry)
+{
+    if (!entry.plural)
+    {
+        writer.value(entry.text);
+        return;
+    }
+
+    // The json orders the keys by the names of the plural categories.
+    static const size_t order[PLURAL_COUNT] = { 3, 4, 1, 5, 2, 0 };
+    writer.beginObject();
+    for (size_t i : order)
+    {
+        if (entry.plural->given & (1u << i))
+        {
+            writer.key(pluralCategoryName(i));
+            writer.value(entry.plural->forms[i].text);
+        }
+    }
+    writer.endObject();
+}
+
+// Writes a file atomically: the content is written to a temporary file in the same directory, that replaces the
+// file on the #commit(), so the readers and a crash see either the old or the whole new content. On the POSIX
+// platforms the temporary file is synced before the rename and the directory is synced after it, otherwise the
+// file is removed before the rename (it is not atomic).
+class AtomicFile
+{
+public:
+    /// @brief Create the temporary file, check the #isOpen().
+    explicit AtomicFile(std::string filename) : filename_(std::move(filename))
+    {
+        static std::atomic<unsigned> counter(0);
+        for (int attempt = 0; attempt < 16 && !isOpen(); ++attempt)
+        {
+#ifdef EASY_TRANSLATE_POSIX
+            temp_ = filename_ + ".tmp" + std::to_string(getpid()) + "." + std::to_string(counter++);
+            fd_ = ::open(temp_.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+            if (fd_ < 0 && errno != EEXIST)
+                break;
+            created_ = fd_ >= 0;
+#else
+            temp_ = filename_ + ".tmp" + std::to_string(counter++);
+            if (std::ifstream(temp_).is_open())
+                continue;
+            stream_.open(temp_, std::ios::binary | std::ios::trunc);
+            if (!stream_.is_open())
+                break;
+            created_ = true;
+#endif // EASY_TRANSLATE_POSIX
+        }
+
+#ifdef EASY_TRANSLATE_POSIX
+        // Keep the permissions of the replaced file.
+        struct stat st;
+        if (fd_ >= 0 && ::stat(filename_.c_str(), &st) == 0)
+            fchmod(fd_, st.st_mode & 07777);
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    /// @brief Remove the temporary file if it is not committed.
+    ~AtomicFile()
+    {
+        close();
+        if (created_ && !committed_)
+            std::remove(temp_.c_str());
+    }
+
+    AtomicFile(const AtomicFile&) = delete;
+    AtomicFile& operator=(const AtomicFile&) = delete;
+
+    const std::string& filename() const { return filename_; }
+
+#ifdef EASY_TRANSLATE_POSIX
+    bool isOpen() const { return fd_ >= 0; }
+
+    int fd() const { return fd_; }
+#else
+    bool isOpen() const { return stream_.is_open(); }
+
+    std::ofstream& stream() { return stream_; }
+#endif // EASY_TRANSLATE_POSIX
+
+    /// @return If failed to write return false else return true.
+    bool write(const char* data, size_t size)
+    {
+        if (!isOpen())
+            return false;
+#ifdef EASY_TRANSLATE_POSIX
+        for (size_t written = 0; written < size;)
+        {
+            ssize_t n = ::write(fd_, data + written, size - written);
+            if (n > 0)
+                written += static_cast<size_t>(n);
+            else if (n < 0 && errno != EINTR)
+            {
+                failed_ = true;
+                return false;
+            }
+        }
+        return true;
+#else
+        return static_cast<bool>(stream_.write(data, static_cast<std::streamsize>(size)));
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    bool write(const std::string& str) { return write(str.data(), str.size()); }
+
+    /// @brief Mark the content is failed to write (e.g. by the #fd()), so the file is not replaced.
+    void fail() { failed_ = true; }
+
+    /// @brief Replace the file with the temporary file. (see the #commitAll())
+    /// @return If failed to write or replace the file return false else return true.
+    bool commit()
+    {
+        AtomicFile* file = this;
+        commitAll(&file, 1);
+        return committed_;
+    }
+
+    bool committed() const { return committed_; }
+
+    /// @brief Replace the files with their temporary files, the syncs are batched so the cost is bounded: the
+    /// temporary files are synced in parallel, then renamed, then each directory is synced once.
+    /// @param threadCount The number of the worker threads that sync the files, 0 means the number of the
+    /// hardware threads.
+    /// @note The failed files (check the #committed()) are not replaced.
+    static void commitAll(AtomicFile* const* files, size_t count, size_t threadCount = 1)
+    {
+        std::vector<char> synced(count, 0);
+        parallelFor(count, threadCount, [&](size_t i) { synced[i] = files[i]->sync() ? 1 : 0; });
+
+        std::set<std::string> directories;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!synced[i] || !files[i]->replace())
+                continue;
+            files[i]->committed_ = true;
+            directories.insert(directoryOf(files[i]->filename_));
+        }
+
+#ifdef EASY_TRANSLATE_POSIX
+        // The rename is durable after the directory is synced, some file systems do not support it and are ignored.
+        for (const auto& directory : directories)
+        {
+            int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0)
+                continue;
+            fsync(fd);
+            ::close(fd);
+        }
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+private:
+    /// @brief Get the directory of the file, "." if the filename has no directory.
+    static std::string directoryOf(const std::string& filename)
+    {
+        size_t pos = filename.find_last_of("/\\");
+        if (pos == std::string::npos)
+            return ".";
+        return pos == 0 ? filename.substr(0, 1) : filename.substr(0, pos);
+    }
+
+    void close()
+    {
+#ifdef EASY_TRANSLATE_POSIX
+        if (fd_ >= 0)
+            ::close(fd_);
+        fd_ = -1;
+#else
+        if (stream_.is_open())
+            stream_.close();
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    /// @brief Flush the temporary file to the storage and close it.
+    /// @return If failed to write or sync return false else return true.
+    bool sync()
+    {
+        if (!isOpen() || failed_)
+            return false;
+#ifdef EASY_TRANSLATE_POSIX
+        bool ok = fsync(fd_) == 0;
+        int fd = fd_;
+        fd_ = -1;
+        return ::close(fd) == 0 && ok;
+#else
+        stream_.flush();
+        bool ok = static_cast<bool>(stream_);
+        stream_.close();
+        return ok;
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    /// @brief Rename the temporary file over the file.
+    bool replace()
+    {
+#ifdef EASY_TRANSLATE_POSIX
+        return std::rename(temp_.c_str(), filename_.c_str()) == 0;
+#else
+        // The rename fails if the file exists on some platforms.
+        if (std::rename(temp_.c_str(), filename_.c_str()) == 0)
+            return true;
+        std::remove(filename_.c_str());
+        return std::rename(temp_.c_str(), filename_.c_str()) == 0;
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    std::string filename_;
+    std::string temp_;
+#ifdef EASY_TRANSLATE_POSIX
+    int fd_ = -1;
+#else
+    std::ofstream stream_;
+#endif // EASY_TRANSLATE_POSIX
+    // Whether the temporary file is created by this, it is removed if not committed.
+    bool created_ = false;
+    bool failed_ = false;
+    bool committed_ = false;
+};
+
+/// @brief Write the content to the file atomically. (see the AtomicFile)
+/// @return If failed to write the file return false else return true.
+inline bool writeFileAtomically(const std::string& filename, const std::string& content)
+{
+    AtomicFile file(filename);
+    return file.write(content) && file.commit();
+}
+
+// A `Translation ID` that stored as its namespace and its name, the namespace is the prefix till the last '.'
+// (e.g. "App.Menu.File." of the "App.Menu.File.Open"). The namespace is stored once and shared by all
+// `Translation ID`s in it, and the short names are mostly stored inside the std::string without allocation.
+class TranslationKey
+{
+public:
+    /// @param space The namespace that outlives the key, the keys of the same namespace use the same pointer.
+    TranslationKey(const std::string* space, std::string name) : space_(space), name_(std::move(name)) {}
+
+    /// @brief Get the namespace, it is empty or ends with the '.'.
+    const std::string& space() const { return *space_; }
+
+    const std::string& name() const { return name_; }
+
+    size_t size() const { return space_->size() + name_.size(); }
+
+    /// @brief Check whether the key is the given `Translation ID`.
+    bool equals(const char* tranId, size_t len) const
+    {
+        return len == size() && std::memcmp(space_->data(), tranId, space_->size()) == 0 &&
+               std::memcmp(name_.data(), tranId + space_->size(), name_.size()) == 0;
+    }
+
+    /// @brief Get the hash of the `Translation ID`, same as the detail::hash() of the whole `Translation ID`.
+    uint64_t hash() const { return detail::hash(name_.data(), name_.size(), detail::hash(space_->data(), space_->size())); }
+
+    /// @brief Get the whole `Translation ID`.
+    std::string str() const { return *space_ + name_; }
+
+    /// @brief The keys are ordered by the namespace, then the name.
+    bool operator<(const TranslationKey& other) const
+    { return space_ == other.space_ ? name_ < other.name_ : *space_ < *other.space_; }
+
+    /// @brief Check whether the whole `Translation ID` is less than the other's, as the json orders the keys.
+    /// (the #operator<() differs, e.g. "A.B.c" < "A.b" but the namespace "A." < "A.B.")
+    bool precedes(const TranslationKey& other) const
+    {
+        if (space_ == other.space_)
+            return name_ < other.name_;
+
+        const std::string* parts[2][2] = { { space_, &name_ }, { other.space_, &other.name_ } };
+        size_t part[2] = { 0, 0 };
+        size_t pos[2] = { 0, 0 };
+        while (true)
+        {
+            for (size_t k = 0; k < 2; ++k)
+            {
+                while (part[k] < 2 && pos[k] == parts[k][part[k]]->size())
+                {
+                    ++part[k];
+                    pos[k] = 0;
+                }
+            }
+            if (part[0] == 2 || part[1] == 2)
+                return part[0] == 2 && part[1] != 2;
+
+            const std::string& a = *parts[0][part[0]];
+            const std::string& b = *parts[1][part[1]];
+            size_t n = std::min(a.size() - pos[0], b.size() - pos[1]);
+            int cmp = std::memcmp(a.data() + pos[0], b.data() + pos[1], n);
+            if (cmp != 0)
+                return cmp < 0;
+            pos[0] += n;
+            pos[1] += n;
+        }
+    }
+
+private:
+    const std::string* space_;
+    std::string name_;
+};
+
+// {Translation ID : Translation text}
+typedef std::pair<const TranslationKey, Entry> TranslationItem;
+
+// The open addressing hash table (linear probing) used to look up the `Translation ID`s.
+// The indexed items are not owned by the index, they must outlive it and not move in memory.
+class HashIndex
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    HashIndex() = default;
+
+    /// @brief Get the item of the given `Translation ID`, if not exists return nullptr.
+    const TranslationItem* find(uint64_t hash, const char* tranId, size_t len) const
+    {
+        size_t slot = findSlot(hash, tranId, len);
+        return slot != npos ? slots_[slot].item : nullptr;
+    }
+
+    /// @brief Get the position of the slot of the given `Translation ID`, if not exists return #npos.
+    size_t findSlot(uint64_t hash, const char* tranId, size_t len) const
+    {
+        if (slots_.empty())
+            return npos;
+
+        size_t mask = slots_.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const Slot& slot = slots_[i];
+            if (!slot.item)
+                return npos;
+            if (slot.hash == hash && slot.item->first.equals(tranId, len))
+                return i;
+        }
+    }
+
+    /// @brief Get the item of the slot at the given position, nullptr if the slot is empty.
+    const TranslationItem* itemAt(size_t slot) const { return slots_[slot].item; }
+
+    /// @brief Prefetch the first slot that the given hash probes.
+    void prefetch(uint64_t hash) const
+    {
+        if (!slots_.empty())
+            EASY_TRANSLATE_PREFETCH(&slots_[hash & (slots_.size() - 1)]);
+    }
+
+    /// @brief Make the index can hold `count` items without rehash.
+    void reserve(size_t count)
+    {
+        size_t capacity = slots_.empty() ? 16 : slots_.size();
+        while (count * 2 > capacity)
+            capacity *= 2;
+        if (capacity > slots_.size())
+            rehash(capacity);
+    }
+
+    /// @brief Add the item to the index.
+    /// @attention The `Translation ID` of the item should not exists in the index.
+    void insert(const TranslationItem* item) { insert(item, item->first.hash()); }
+
+    /// @brief Add the item to the index with the hash of its `Translation ID` that computed already.
+    /// @attention The `Translation ID` of the item should not exists in the index.
+    void insert(const TranslationItem* item, uint64_t hash)
+    {
+        if ((size_ + 1) * 2 > slots_.size())
+            rehash(slots_.empty() ? 16 : slots_.size() * 2);
+        place(Slot{ hash, item });
+        size_++;
+    }
+
+    /// @brief Remove the item from the index. (backward shift deletion)
+    void erase(const TranslationItem* item)
+    {
+        if (slots_.empty())
+            return;
+
+        size_t mask = slots_.size() - 1;
+        size_t i = item->first.hash() & mask;
+        for (; slots_[i].item != item; i = (i + 1) & mask)
+        {
+            if (!slots_[i].item)
+                return;
+        }
+
+        for (size_t j = (i + 1) & mask; slots_[j].item; j = (j + 1) & mask)
+        {
+            size_t home = slots_[j].hash & mask;
+            bool between = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+            if (!between)
+            {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i] = Slot();
+        size_--;
+    }
+
+    /// @brief Remove all items from the index.
+    void clear()
+    {
+        slots_.clear();
+        size_ = 0;
+    }
+
+    /// @brief Get the number of the indexed items.
+    size_t size() const { return size_; }
+
+    /// @brief Get the number of the slots.
+    size_t capacity() const { return slots_.size(); }
+
+private:
+    struct Slot
+    {
+        uint64_t hash = 0;
+        const TranslationItem* item = nullptr;
+
+        Slot() = default;
+
+        Slot(uint64_t hash, const TranslationItem* item) : hash(hash), item(item) {}
+    };
+
+    void place(const Slot& slot)
+    {
+        size_t mask = slots_.size() - 1;
+        size_t i = slot.hash & mask;
+        while (slots_[i].item)
+            i = (i + 1) & mask;
+        slots_[i] = slot;
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> old(capacity);
+        old.swap(slots_);
+        for (const auto& slot : old)
+        {
+            if (slot.item)
+                place(slot);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+};
+
+#ifdef EASY_TRANSLATE_ID_REGISTRY
+// The bounds of the section that the EASYTR() records the `Translation ID`s, defined by the linker.
+// (weak, so they are null if no EASYTR() is used)
+extern "C" __attribute__((weak)) const char* const __start_easytr_ids[];
+extern "C" __attribute__((weak)) const char* const __stop_easytr_ids[];
+#endif // EASY_TRANSLATE_ID_REGISTRY
+
+#ifdef EASY_TRANSLATE_MISSING_LOG
+// The fixed capacity table that records each missing pair of the `Language ID` and `Translation ID` once until
+// it is taken. The producers never lock or allocate, the consumer takes the new records.
+//   - A pair is found by its key, then by its (truncated) `Language ID` and `Translation ID`, so the pairs of
+//     the same key are recorded apart. A producer that finds a record of the same key still being written
+//     waits for its few stores, then compares it.
+//   - The slot of a record is freed once the record is taken, so a pair that is still missing is recorded
+//     again on its next miss, and the table only fills with the records that are not taken yet.
+//   - If the probes of a pair find neither its record nor a free slot, the miss is dropped and counted.
+// The strings of a slot are the words of relaxed atomics, and its version is increased when it is freed, so a
+// producer compares them while the slot may be taken and reused, and retries if the version is changed.
+class MissingLog
+{
+public:
+    static constexpr size_t capacity = EASY_TRANSLATE_MISSING_LOG_CAPACITY;
+    static constexpr size_t maxProbes = 64;
+
+    static_assert((capacity & (capacity - 1)) == 0, "The capacity of the MissingLog should be a power of 2.");
+
+    MissingLog()
+    {
+        for (auto& slot : slots_)
+        {
+            slot.key.store(0, std::memory_order_relaxed);
+            slot.state.store(EMPTY, std::memory_order_relaxed);
+            slot.version.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MissingLog(const MissingLog&) = delete;
+
+    MissingLog& operator=(const MissingLog&) = delete;
+
+    /// @brief Record the missing pair, if it is already recorded and not taken yet do nothing.
+    /// @param key The nonzero key of the pair, e.g. the mix of the hashes of the `Language ID` and `Translation ID`.
+    /// @note The too long `Language ID` and `Translation ID` are truncated.
+    void record(uint64_t key, const std::string& languageId, const char* tranId, size_t len)
+    {
+        Text text;
+        pack(text, languageId.c_str(), languageId.size(), tranId, len);
+
+        for (size_t i = 0, pos = key & (capacity - 1); i < maxProbes; ++i)
+        {
+            Slot& slot = slots_[pos];
+            uint32_t version = slot.version.load(std::memory_order_acquire);
+            uint64_t expected = slot.key.load(std::memory_order_acquire);
+            if (expected == 0)
+            {
+                if (slot.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel))
+                {
+                    // The strings are written after the free of the slot, see the #matches().
+                    std::atomic_thread_fence(std::memory_order_release);
+                    for (size_t w = 0; w < WORDS; ++w)
+                        slot.text[w].store(text[w], std::memory_order_relaxed);
+                    slot.state.store(READY, std::memory_order_release);
+                    return;
+                }
+            }
+
+            if (expected == key)
+            {
+                // The record of the same key may be still being written, wait for it so its strings are compared,
+                // the writer is only a few stores away from the READY. If the slot is being freed instead, its
+                // version or key changes.
+                uint8_t state;
+                while ((state = slot.state.load(std::memory_order_acquire)) == EMPTY &&
+                       slot.version.load(std::memory_order_relaxed) == version &&
+                       slot.key.load(std::memory_order_relaxed) == key)
+                    std::this_thread::yield();
+                int match = state == EMPTY ? -1 : matches(slot, text, version);
+                if (match > 0)
+                    return;
+                if (match < 0)
+                    continue; // The slot is freed meanwhile, check it again.
+            }
+
+            pos = (pos + 1) & (capacity - 1);
+        }
+
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Call the `callback` with the `Language ID` and `Translation ID` of each record that is not taken
+    /// yet, then free its slot.
+    template <typename Callback>
+    void take(Callback callback)
+    {
+        Text text;
+        for (auto& slot : slots_)
+        {
+            uint8_t state = READY;
+            if (!slot.state.compare_exchange_strong(state, TAKEN, std::memory_order_acquire))
+                continue;
+
+            for (size_t w = 0; w < WORDS; ++w)
+                text[w] = slot.text[w].load(std::memory_order_relaxed);
+            char languageId[LANGUAGE_SIZE];
+            char tranId[TEXT_SIZE - LANGUAGE_SIZE];
+            std::memcpy(languageId, text, sizeof(languageId));
+            std::memcpy(tranId, reinterpret_cast<const char*>(text) + LANGUAGE_SIZE, sizeof(tranId));
+            callback(static_cast<const char*>(languageId), static_cast<const char*>(tranId));
+
+            slot.version.fetch_add(1, std::memory_order_relaxed);
+            slot.state.store(EMPTY, std::memory_order_release);
+            slot.key.store(0, std::memory_order_release);
+        }
+    }
+
+    /// @brief Get the number of the misses that are dropped since the table is full.
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    enum State : uint8_t
+    {
+        // Free, or being written after the key is set.
+        EMPTY,
+        READY,
+        TAKEN
+    };
+
+    // The null-terminated `Language ID` and `Translation ID`, padded with '\0'.
+    static constexpr size_t LANGUAGE_SIZE = 32;
+    static constexpr size_t TEXT_SIZE = 248;
+    static constexpr size_t WORDS = TEXT_SIZE / sizeof(uint64_t);
+
+    typedef uint64_t Text[WORDS];
+
+    struct Slot
+    {
+        std::atomic<uint64_t> key;
+        std::atomic<uint8_t> state;
+        std::atomic<uint32_t> version;
+        std::atomic<uint64_t> text[WORDS];
+    };
+
+    static void pack(Text& text, const char* languageId, size_t languageLen, const char* tranId, size_t len)
+    {
+        char* bytes = reinterpret_cast<char*>(text);
+        std::memset(bytes, 0, TEXT_SIZE);
+        std::memcpy(bytes, languageId, languageLen < LANGUAGE_SIZE - 1 ? languageLen : LANGUAGE_SIZE - 1);
+        std::memcpy(bytes + LANGUAGE_SIZE, tranId, len < TEXT_SIZE - LANGUAGE_SIZE - 1 ? len : TEXT_SIZE - LANGUAGE_SIZE - 1);
+    }
+
+    /// @brief Compare the strings of the slot with the `text`, the `version` is read before the key of the slot.
+    /// @return 1 if they are same, 0 if they are not, -1 if the slot is freed since the `version`.
+    static int matches(const Slot& slot, const Text& text, uint32_t version)
+    {
+        bool same = true;
+        for (size_t w = 0; w < WORDS && same; ++w)
+            same = slot.text[w].load(std::memory_order_relaxed) == text[w];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) != version)
+            return -1;
+        return same ? 1 : 0;
+    }
+
+    Slot slots_[capacity];
+    std::atomic<uint64_t> dropped_{ 0 };
+};
+#endif // EASY_TRANSLATE_MISSING_LOG
+
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+/// @brief Check whether the file exists and is a valid json, it is not while the file is being written.
+inline bool isJsonFile(const std::string& filename)
+{
+    std::ifstream ifs(filename);
+    if (!ifs.is_open())
+        return false;
+    return !nlohmann::json::parse(ifs, nullptr, false, true).is_discarded();
+}
+
+// Watch the changes of the files by the inotify. The directories of the files are watched instead of the files,
+// so a file that is replaced by the rename (like the most editors save) is still watched.
+class FileWatcher
+{
+public:
+    enum WaitResult
+    {
+        WAIT_CHANGED,
+        WAIT_NONE,
+        WAIT_WOKEN
+    };
+
+    FileWatcher() : fd_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    {
+        if (pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0)
+            wakePipe_[0] = wakePipe_[1] = -1;
+    }
+
+    ~FileWatcher()
+    {
+        for (int fd : { fd_, wakePipe_[0], wakePipe_[1] })
+        {
+            if (fd >= 0)
+                close(fd);
+        }
+    }
+
+    FileWatcher(const FileWatcher&) = delete;
+
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    bool isValid() const { return fd_ >= 0 && wakePipe_[0] >= 0; }
+
+    /// @brief Replace the watched files, the directories that no longer have any watched file are unwatched.
+    void watch(const std::set<std::string>& files)
+    {
+        // The IN_MODIFY delays the reload until the file is written completely.
+        const uint32_t mask = IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM;
+
+        std::map<int, std::map<std::string, std::string>> watches;
+        for (const auto& file : files)
+        {
+            size_t slash = file.find_last_of('/');
+            std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : file.substr(0, slash));
+            // The same directory given by the different paths gets the same watch descriptor.
+            int wd = inotify_add_watch(fd_, dir.c_str(), mask);
+            if (wd >= 0)
+                watches[wd].insert({ file.substr(slash + 1), file });
+        }
+
+        for (const auto& var : watches_)
+        {
+            if (watches.find(var.first) == watches.end())
+                inotify_rm_watch(fd_, var.first);
+        }
+        watches_.swap(watches);
+    }
+
+    /// @brief Wake the #wait() that is waiting on the other thread.
+    void wake()
+    {
+        char c = 0;
+        // If the pipe is full, the #wait() is woken already.
+        ssize_t written = write(wakePipe_[1], &c, 1);
+        (void) written;
+    }
+
+    /// @brief Wait for the changes of the watched files or the #wake().
+    /// @param timeout The max milliseconds to wait, -1 means infinite.
+    /// @param changed The changed files are inserted to it, by the paths that given to the #watch().
+    /// @return WAIT_CHANGED if any watched file is changed, WAIT_WOKEN if woken by the #wake(), otherwise
+    /// WAIT_NONE. (timeout, or only the other files of the directories are changed)
+    WaitResult wait(int timeout, std::set<std::string>& changed)
+    {
+        pollfd fds[2] = { { fd_, POLLIN, 0 }, { wakePipe_[0], POLLIN, 0 } };
+        if (poll(fds, 2, timeout) <= 0)
+            return WAIT_NONE;
+
+        if (fds[1].revents & POLLIN)
+        {
+            char buffer[64];
+            while (read(wakePipe_[0], buffer, sizeof(buffer)) > 0) {}
+            return WAIT_WOKEN;
+        }
+
+        bool any = false;
+        alignas(inotify_event) char buffer[4096];
+        ssize_t len;
+        while ((len = read(fd_, buffer, sizeof(buffer))) > 0)
+        {
+            for (ssize_t i = 0; i < len; i += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(buffer + i)->len)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + i);
+                auto watch = watches_.find(event->wd);
+                if (watch == watches_.end() || event->len == 0)
+                    continue;
+                auto it = watch->second.find(event->name);
+                if (it != watch->second.end())
+                {
+                    changed.insert(it->second);
+                    any = true;
+                }
+            }
+        }
+        return any ? WAIT_CHANGED : WAIT_NONE;
+    }
+
+private:
+    int fd_;
+    int wakePipe_[2];
+    // {Watch descriptor : {Filename : Watched path}}
+    std::map<int, std::map<std::string, std::string>> watches_;
+};
+#endif // EASY_TRANSLATE_HOT_RELOAD
+
+} // namespace detail
+
+#ifdef EASY_TRANSLATE_ID_REGISTRY
+/// @brief Get all `Translation ID`s that are passed to the EASYTR() in the program. (include the code paths
+/// that never run)
+/// @note Only available when define the macro \ref EASY_TRANSLATE_ID_REGISTRY.
+inline std::set<std::string> registeredIds()
+{
+    std::set<std::string> ids;
+    for (const char* const* it = detail::__start_easytr_ids; it && it != detail::__stop_easytr_ids; ++it)
+        ids.insert(*it);
+    return ids;
+}
+#endif // EASY_TRANSLATE_ID_REGISTRY
+
+// An entry of the EmbeddedCatalog, the offsets are into the EmbeddedCatalog::strings.
+struct EmbeddedEntry
+{
+    // The detail::hash() of the `Translation ID`.
+    uint64_t hash;
+    uint32_t id;
+    uint32_t idLength;
+    // The length of the namespace of the `Translation ID`, see the detail::TranslationKey.
+    uint32_t spaceLength;
+    uint32_t text;
+    uint32_t textLength;
+    // The plural category of the `Translation text`, detail::PLURAL_COUNT if it is not a plural form.
+    // The plural forms of a `Translation ID` are adjacent.
+    uint8_t form;
+};
+
+// The `Translations` that compiled into the binary by the CMake function easy_translate_embed_catalog(),
+// it is a constant table in the read-only data, see the Languages::addEmbedded().
+struct EmbeddedCatalog
+{
+    const char* name;
+    // The null-terminated `Translation ID`s and `Translation text`s.
+    const char* strings;
+    // The entries ordered like the Translations, by the namespace, then the name.
+    const EmbeddedEntry* entries;
+    size_t count;
+    // The open addressing hash table (linear probing) of the `Translation ID`s, a slot is the position of the
+    // first entry of a `Translation ID` plus 1, or 0 if it is empty. The number of the slots is a power of 2.
+    // nullptr if the catalog has not the table (e.g. in a Bundle), then it is loaded by the
+    // Translations::fromEmbedded() instead of looked up in place.
+    const uint32_t* slots;
+    size_t slotCount;
+};
+
+namespace detail
+{
+
+/// @brief Get the position of the slot of the given `Translation ID` in the EmbeddedCatalog::slots,
+/// if not exists return static_cast<size_t>(-1).
+inline size_t findEmbeddedSlot(const EmbeddedCatalog& catalog, uint64_t hash, const char* tranId, size_t len)
+{
+    size_t mask = catalog.slotCount - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask)
+    {
+        if (catalog.slots[i] == 0)
+            return static_cast<size_t>(-1);
+        const EmbeddedEntry& entry = catalog.entries[catalog.slots[i] - 1];
+        if (entry.hash == hash && entry.idLength == len && std::memcmp(catalog.strings + entry.id, tranId, len) == 0)
+            return i;
+    }
+}
+
+/// @brief Make the entry of the `Translation ID` whose first entry is at the given position of the
+/// EmbeddedCatalog::entries, its plural forms are the adjacent entries.
+inline Entry embeddedEntryAt(const EmbeddedCatalog& catalog, size_t first)
+{
+    const EmbeddedEntry& entry = catalog.entries[first];
+    if (entry.form == PLURAL_COUNT)
+        return Entry(std::string(catalog.strings + entry.text, entry.textLength));
+
+    std::map<std::string, std::string> forms;
+    for (size_t i = first; i < catalog.count && catalog.entries[i].id == entry.id; ++i)
+    {
+        const EmbeddedEntry& form = catalog.entries[i];
+        forms[pluralCategoryName(form.form)].assign(catalog.strings + form.text, form.textLength);
+    }
+    return Entry::fromPluralForms(forms);
+}
+
+// {Catalog name : EmbeddedCatalog}
+inline std::map<std::string, const EmbeddedCatalog*>& embeddedCatalogs()
+{
+    static std::map<std::string, const EmbeddedCatalog*> catalogs;
+    return catalogs;
+}
+
+inline std::mutex& embeddedCatalogsMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // namespace detail
+
+/// @brief Register the embedded catalog by its name, the generated source of the catalog registers it on the
+/// static initialization. If the name is already registered, replace it.
+inline void registerEmbeddedCatalog(const EmbeddedCatalog& catalog)
+{
+    std::lock_guard<std::mutex> lock(detail::embeddedCatalogsMutex());
+    detail::embeddedCatalogs()[catalog.name] = &catalog;
+}
+
+/// @brief Get the embedded catalog of the given name, if not registered return nullptr.
+inline const EmbeddedCatalog* findEmbeddedCatalog(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(detail::embeddedCatalogsMutex());
+    auto it = detail::embeddedCatalogs().find(name);
+    return it != detail::embeddedCatalogs().end() ? it->second : nullptr;
+}
+
+// Register an embedded catalog on the static initialization, see the registerEmbeddedCatalog().
+struct EmbeddedCatalogRegistrar
+{
+    explicit EmbeddedCatalogRegistrar(const EmbeddedCatalog& catalog) { registerEmbeddedCatalog(catalog); }
+};
+
+class Translations;
+
+// The source that the `Translations` of a language is loaded from, e.g. the FileSource, MemorySource and
+// BundleSource. Implement it to load the `Translations` from anywhere, see the Languages::addSource().
+class TranslationsSource
+{
+public:
+    virtual ~TranslationsSource() = default;
+
+    /// @brief Load the `Translations`, if failed return empty.
+    virtual Translations load() const = 0;
+
+    /// @brief Get the description of the source (e.g. the filename), it is the `Translations filename` of the
+    /// language that uses the source.
+    virtual std::string name() const = 0;
+
+    /// @brief Get the json value of the source in the `Languages file`, null if it can not be written to the file.
+    virtual nlohmann::json toJson() const { return nullptr; }
+};
+
+class Languages
+{
+    friend class TranslateManager;
+
+public:
+    Languages() = default;
+
+    Languages(const std::vector<std::pair<std::string, std::string>>& langs)
+    {
+        for (const auto& var : langs)
+            languages_.insert({ var.first, var.second });
+    }
+
+    Languages(const std::map<std::string, std::string>& langs) : languages_(langs) {}
+
+    /// @brief Load the `Languages` from a json string.
+    /// @note If the json is invalid, the `Languages` will be empty.
+    static Languages fromJson(const std::string& json)
+    {
+        using Json = nlohmann::json;
+
+        Json j = Json::parse(json, nullptr, false, true);
+        if (j.is_discarded())
+            return Languages();
+
+        return fromJsonObject(j);
+    }
+
+    /// @brief Load the `Languages` from a json file.
+    /// @note If the json is invalid, the `Languages` will be empty.
+    static Languages fromFile(const std::string& filename)
+    {
+        using Json = nlohmann::json;
+
+        std::ifstream ifs(filename);
+        if (!ifs.is_open())
+            return Languages();
+
+        Json j = Json::parse(ifs, nullptr, false, true);
+        if (j.is_discarded())
+        {
+            ifs.close();
+            return Languages();
+        }
+
+        ifs.close();
+        return fromJsonObject(j);
+    }
+
+    /// @brief Get the json string.
+    std::string toJson() const
+    {
+        nlohmann::json j;
+        for (const auto& var : languages_)
+        {
+            std::string fallbackId = fallback(var.first);
+            std::string baseId = base(var.first);
+            nlohmann::json value = var.second;
+            auto source = sources_.find(var.first);
+            if (source != sources_.end())
+            {
+                // The source that is not a file (e.g. a memory buffer) can not be written.
+                value = source->second->toJson();
+                if (value.is_null())
+                    continue;
+            }
+
+            bool manifest = isManifest(var.first);
+            bool embedded = isEmbedded(var.first);
+            if (fallbackId.empty() && baseId.empty() && !manifest && !embedded)
+            {
+                j[var.first] = value;
+                continue;
+            }
+
+            if (value.is_object())
+                j[var.first] = value;
+            else
+                j[var.first] = { { manifest ? "manifest" : (embedded ? "embedded" : "file"), value } };
+            if (!fallbackId.empty())
+                j[var.first]["fallback"] = fallbackId;
+            if (!baseId.empty())
+                j[var.first]["base"] = baseId;
+        }
+        return j.dump(4);
+    }
+
+    /// @brief Write the `Languages` to a json file.
+    /// @return If the failed to write the file return false else return true.
+    /// @note The file is replaced atomically, see the detail::AtomicFile.
+    bool toFile(const std::string& filename = "languages.json") const
+    { return detail::writeFileAtomically(filename, toJson()); }
+
+    /// @brief Get the `Translations filename` of the given `Language ID`.
+    const char* at(const std::string& languageId) const
+    { return languages_.at(languageId).c_str(); }
+
+    /// @brief Get the number of the `Language ID`.
+    size_t count() const { return languages_.size(); }
+
+    /// @brief Check whether has not any `Language ID`.
+    bool empty() const { return count() == 0; }
+
+    /// @brief Check whether exists the given `Language ID`.
+    bool has(const std::string& languageId) const
+    { return languages_.find(languageId) != languages_.end(); }
+
+    /// @brief Get all `Language ID`s.
+    std::vector<std::string> getIds() const
+    {
+        std::vector<std::string> ids;
+        for (const auto& var : languages_)
+            ids.push_back(var.first);
+        return ids;
+    }
+
+    /// @brief Add a pair of the `Language ID` and `Translations filename`.
+    /// @note If the given `Language ID` already exists, do nothing.
+    void add(const std::string& languageId, const std::string& translationsFilename)
+    {
+        if (!has(languageId))
+            languages_.insert({ languageId, translationsFilename });
+    }
+
+    /// @brief Add a pair of the `Language ID` and the manifest filename of the split `Translations`, its
+    /// `Translation ID`s are split to the files by the namespace (the first segment of the `Translation ID`).
+    /// @note - The manifest is a json object {Namespace : Translations filename}, the relative filenames are
+    /// relative to the manifest file. (e.g. {"Settings": "settings.json", "": "common.json"})
+    /// @note - The `Translation ID`s in the file of a namespace omit the namespace, the file of the empty
+    /// namespace has the `Translation ID`s whose namespace is not listed, with the namespace.
+    /// @note - The file of a namespace is loaded the first time a `Translation ID` in the namespace is looked up.
+    /// @note - If the given `Language ID` already exists, do nothing.
+    void addManifest(const std::string& languageId, const std::string& manifestFilename)
+    {
+        if (has(languageId))
+            return;
+        languages_.insert({ languageId, manifestFilename });
+        manifests_.insert(languageId);
+    }
+
+    /// @brief Check whether the `Translations filename` of the given `Language ID` is a manifest filename.
+    bool isManifest(const std::string& languageId) const { return manifests_.find(languageId) != manifests_.end(); }
+
+    /// @brief Add a pair of the `Language ID` and the name of an embedded catalog, that is compiled into the
+    /// binary by the CMake function easy_translate_embed_catalog(). Loading it does no file I/O and no json
+    /// parsing.
+    /// @note - The catalog is looked up by the name when the language is loaded, the language is empty if the
+    /// catalog is not registered. (see the easytr::findEmbeddedCatalog())
+    /// @note - If the given `Language ID` already exists, do nothing.
+    void addEmbedded(const std::string& languageId, const std::string& catalogName)
+    {
+        if (has(languageId))
+            return;
+        languages_.insert({ languageId, catalogName });
+        embedded_.insert(languageId);
+    }
+
+    /// @brief Check whether the `Translations filename` of the given `Language ID` is the name of an
+    /// embedded catalog.
+    bool isEmbedded(const std::string& languageId) const { return embedded_.find(languageId) != embedded_.end(); }
+
+    /// @brief Add a pair of the `Language ID` and the source that its `Translations` is loaded from, e.g. the
+    /// BundleSource that serves all languages from a single file, or the MemorySource.
+    /// @note - The `Translations filename` of the language is the TranslationsSource::name().
+    /// @note - If the given `Language ID` already exists or the source is nullptr, do nothing.
+    void addSource(const std::string& languageId, std::shared_ptr<const TranslationsSource> source)
+    {
+        if (has(languageId) || !source)
+            return;
+        languages_.insert({ languageId, source->name() });
+        sources_.insert({ languageId, std::move(source) });
+    }
+
+    /// @brief Get the source of the given `Language ID` that added by the #addSource(), nullptr if not has.
+    std::shared_ptr<const TranslationsSource> source(const std::string& languageId) const
+    {
+        auto it = sources_.find(languageId);
+        return it != sources_.end() ? it->second : nullptr;
+    }
+
+    /// @brief Remove a `Language ID` and it corresponding `Translations filename`.
+    void remove(const std::string& languageId)
+    {
+        if (has(languageId))
+            languages_.erase(languageId);
+        fallbacks_.erase(languageId);
+        bases_.erase(languageId);
+        manifests_.erase(languageId);
+        embedded_.erase(languageId);
+        sources_.erase(languageId);
+    }
+
+    /// @brief Remove all `Language ID`s and it corresponding `Translations filename`s.
+    void clear()
+    {
+        languages_.clear();
+        fallbacks_.clear();
+        bases_.clear();
+        manifests_.clear();
+        embedded_.clear();
+        sources_.clear();
+    }
+
+    /// @brief Set the fallback language of the given language, the `Translation ID`s that not exist on the
+    /// language are looked up on the fallback language, and then its fallback language, and so on.
+    /// @note If the `fallbackId` is empty, remove the fallback language.
+    void setFallback(const std::string& languageId, const std::string& fallbackId)
+    {
+        if (fallbackId.empty())
+            fallbacks_.erase(languageId);
+        else
+            fallbacks_[languageId] = fallbackId;
+    }
+
+    /// @brief Get the fallback `Language ID` of the given language, if not has return empty string.
+    std::string fallback(const std::string& languageId) const
+    {
+        auto it = fallbacks_.find(languageId);
+        return it != fallbacks_.end() ? it->second : std::string();
+    }
+
+    /// @brief Set the base language of the given language, it makes the `Translations file` of the language a
+    /// delta file that only has the `Translation ID`s that overridden, the others are looked up on the base
+    /// language. (e.g. the "en_GB" that based on the "en_US")
+    /// @note - Unlike the fallback language, the delta language shares the loaded `Translations` of the base
+    /// language, so the load time and memory of the delta language scale with the size of the delta file.
+    /// @note - If the `baseId` is empty, remove the base language.
+    void setBase(const std::string& languageId, const std::string& baseId)
+    {
+        if (baseId.empty())
+            bases_.erase(languageId);
+        else
+            bases_[languageId] = baseId;
+    }
+
+    /// @brief Get the base `Language ID` of the given language, if not has return empty string.
+    std::string base(const std::string& languageId) const
+    {
+        auto it = bases_.find(languageId);
+        return it != bases_.end() ? it->second : std::string();
+    }
+
+    /// @brief Get the given `Language ID` and its fallback `Language ID`s in order, the chain stops at the
+    /// language that not exists or already in the chain.
+    std::vector<std::string> fallbackChain(const std::string& languageId) const
+    {
+        std::vector<std::string> chain;
+        for (std::string id = languageId; has(id); id = fallback(id))
+        {
+            if (std::find(chain.begin(), chain.end(), id) != chain.end())
+                break;
+            chain.push_back(id);
+        }
+        return chain;
+    }
+
+private:
+    /// @brief Load the `Languages` from a json object, the value of a language is either the
+    /// `Translations filename` or an object {"file": Translations filename, "fallback": Language ID,
+    /// "base": Language ID}. (the "fallback" and "base" are optional, the "manifest": Manifest filename
+    /// instead of the "file" for the split `Translations`, the "embedded": Catalog name for the embedded catalog,
+    /// the "bundle": Bundle filename and "entry": Catalog name for the catalog of a Bundle, the "entry" is the
+    /// `Language ID` if omitted)
+    static Languages fromJsonObject(const nlohmann::json& j);
+
+    // {Language ID : Translations filename}
+    std::map<std::string, std::string> languages_;
+    // {Language ID : Fallback Language ID}
+    std::map<std::string, std::string> fallbacks_;
+    // {Language ID : Base Language ID}
+    std::map<std::string, std::string> bases_;
+    // The `Language ID`s whose `Translations filename` is a manifest filename.
+    std::set<std::string> manifests_;
+    // The `Language ID`s whose `Translations filename` is the name of an embedded catalog.
+    std::set<std::string> embedded_;
+    // {Language ID : Source}, see the #addSource().
+    std::map<std::string, std::shared_ptr<const TranslationsSource>> sources_;
+};
+
+/// @brief A `Translation text` with its length, the text is null-terminated.
+struct TextView
+{
+    const char* data;
+    size_t size;
+
+    const char* c_str() const { return data; }
+
+    bool empty() const { return size == 0; }
+
+    std::string str() const { return std::string(data, size); }
+
+    operator std::string() const { return str(); }
+
+#if EASY_TRANSLATE_CPLUSPLUS >= 201703L
+    operator std::string_view() const { return std::string_view(data, size); }
+#endif
+};
+
+/// @brief A `Translation ID` and its `Translation text` in the `Translations`, it refers to them without copy.
+struct TranslationView
+{
+    const detail::TranslationKey* key;
+    const detail::Entry* entry;
+
+    /// @brief Get the whole `Translation ID`, it is built since the namespace and name are stored apart.
+    std::string id() const { return key->str(); }
+
+    /// @brief Get the namespace of the `Translation ID`, it is empty or ends with the '.'.
+    const std::string& space() const { return key->space(); }
+
+    /// @brief Get the `Translation ID` without the namespace.
+    const std::string& name() const { return key->name(); }
+
+    TextView text() const { return TextView{ entry->text.c_str(), entry->text.size() }; }
+};
+
+class Translations
+{
+    friend class TranslateManager;
+    friend class Overlay;
+public:
+    Translations() = default;
+
+    Translations(const std::vector<std::pair<std::string, std::string>>& trans)
+    {
+        for (const auto& var : trans)
+            insert(var.first, var.second);
+    }
+
+    Translations(const std::map<std::string, std::string>& trans)
+    {
+        for (const auto& var : trans)
+            insert(var.first, var.second);
+    }
+
+    Translations(const Translations& other) { copyFrom(other); }
+
+    Translations(Translations&& other) = default;
+
+    Translations& operator=(const Translations& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    Translations& operator=(Translations&& other) = default;
+
+    /// @brief Load the `Translations` from a json string.
+    /// @note - The nested objects are the namespaces that flattened to the dotted `Translation ID`s.
+    /// (e.g. {"App": {"Menu": {"Open": "Open"}}} is {"App.Menu.Open": "Open"})
+    /// @note - If the json is invalid, the `Translations` will be empty.
+    static Translations fromJson(const std::string& json)
+    {
+        using Json = nlohmann::json;
+
+        Json j = Json::parse(json, nullptr, false, true);
+        if (j.is_discarded())
+            return Translations();
+
+        return fromJsonObject(j);
+    }
+
+    /// @brief Load the `Translations` from a json buffer, it is parsed in place without copy.
+    /// (see the #fromJson())
+    static Translations fromJson(const char* data, size_t size)
+    {
+        using Json = nlohmann::json;
+
+        Json j = Json::parse(data, data + size, nullptr, false, true);
+        if (j.is_discarded())
+            return Translations();
+
+        return fromJsonObject(j);
+    }
+
+    /// @brief Load the `Translations` from a json file. (see the #fromJson())
+    /// @note If the json is invalid, the `Translations` will be empty.
+    static Translations fromFile(const std::string& filename) { return fromFile(filename, std::string()); }
+
+    /// @brief Load all files of the split `Translations` from a manifest file, the files are parsed in parallel.
+    /// (see the Languages::addManifest())
+    /// @param threadCount The number of the worker threads, 0 means the number of the hardware threads.
+    /// @note The invalid files are ignored.
+    static Translations fromManifest(const std::string& filename, size_t threadCount = 0)
+    {
+        std::map<std::string, std::string> manifest = detail::readManifest(filename);
+        std::vector<std::pair<std::string, std::string>> files(manifest.begin(), manifest.end());
+        std::vector<Translations> parts(files.size());
+        detail::parallelFor(files.size(), threadCount, [&](size_t i) {
+            parts[i] = fromFile(files[i].second, files[i].first.empty() ? std::string() : files[i].first + ".");
+        });
+
+        Translations trans;
+        for (const auto& part : parts)
+            trans.copyFrom(part);
+        return trans;
+    }
+
+    /// @brief Load the `Translations` from an embedded catalog, without the file I/O and json parsing.
+    /// (see the Languages::addEmbedded())
+    /// @note The entries are ordered and hashed already, so they are appended to the storage and index directly.
+    static Translations fromEmbedded(const EmbeddedCatalog& catalog)
+    {
+        Translations trans;
+        trans.index_.reserve(catalog.count);
+
+        const std::string* space = nullptr;
+        for (size_t i = 0; i < catalog.count;)
+        {
+            const EmbeddedEntry& first = catalog.entries[i];
+            const char* tranId = catalog.strings + first.id;
+            if (!space || space->size() != first.spaceLength || std::memcmp(space->data(), tranId, first.spaceLength) != 0)
+                space = &*trans.namespaces_.insert(std::string(tranId, first.spaceLength)).first;
+
+            size_t count = trans.translations_.size();
+            auto it = trans.translations_.emplace_hint(
+                trans.translations_.end(),
+                detail::TranslationKey(space, std::string(tranId + first.spaceLength, first.idLength - first.spaceLength)),
+                detail::embeddedEntryAt(catalog, i));
+            if (trans.translations_.size() != count)
+                trans.index_.insert(&*it, first.hash);
+
+            do
+                ++i;
+            while (i < catalog.count && catalog.entries[i].id == first.id);
+        }
+        return trans;
+    }
+
+    /// @brief Get the json string, the `Translation ID`s are sorted and the indent is 4 spaces.
+    std::string toJson() const
+    {
+        std::string json;
+        detail::JsonWriter writer(json);
+        writeJson(writer);
+        return json;
+    }
+
+    /// @brief Write the json (see the #toJson()) to the stream, without building the whole json in the memory.
+    /// @return If the failed to write return false else return true.
+    bool toStream(std::ostream& stream) const
+    {
+        detail::JsonWriter writer(stream);
+        writeJson(writer);
+        return writer.flush();
+    }
+
+#ifdef EASY_TRANSLATE_POSIX
+    /// @brief Write the json (see the #toJson()) to the file descriptor, without building the whole json in the
+    /// memory.
+    /// @return If the failed to write return false else return true.
+    /// @note Only available on the POSIX platforms.
+    bool toFileDescriptor(int fd) const
+    {
+        detail::JsonWriter writer(fd);
+        writeJson(writer);
+        return writer.flush();
+    }
+#endif // EASY_TRANSLATE_POSIX
+
+    /// @brief Write the `Translations` to a json file. (see the #toStream())
+    /// @return If the failed to write the file return false else return true.
+    /// @note The file is replaced atomically, the readers never see a partially written file.
+    /// (see the detail::AtomicFile)
+    bool toFile(const std::string& filename) const
+    {
+        detail::AtomicFile file(filename);
+        if (!file.isOpen())
+            return false;
+#ifdef EASY_TRANSLATE_POSIX
+        if (!toFileDescriptor(file.fd()))
+            file.fail();
+#else
+        if (!toStream(file.stream()))
+            file.fail();
+#endif // EASY_TRANSLATE_POSIX
+        return file.commit();
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID`.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    const char* at(const std::string& tranId) const
+    {
+        const char* text = find(tranId.c_str(), tranId.size(), detail::hash(tranId.c_str(), tranId.size()));
+        return text ? text : tranId.c_str();
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID`.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    const char* at(const char* tranId) const
+    {
+        size_t len = std::strlen(tranId);
+        const char* text = find(tranId, len, detail::hash(tranId, len));
+        return text ? text : tranId;
+    }
+
+    /// @brief Get the number of the `Translation ID`.
+    size_t count() const { return translations_.size(); }
+
+    /// @brief Check whether has not any `Translation ID`.
+    bool empty() const { return count() == 0; }
+
+    /// @brief Check whether exists the given `Translation ID`.
+    bool has(const std::string& tranId) const
+    { return find(tranId.c_str(), tranId.size(), detail::hash(tranId.c_str(), tranId.size())) != nullptr; }
+
+    class PrefixRange;
+
+    /// @brief Get the `Translation ID`s that start with the given prefix and their `Translation text`s,
+    /// without copy. (e.g. the "Settings.Network." for all `Translation ID`s in the namespace)
+    /// @note - The range is ordered by the namespace, then the name. (see the detail::TranslationKey)
+    /// @note - The range is invalid after the `Translations` is modified or destroyed.
+    PrefixRange withPrefix(const std::string& prefix) const;
+
+    /// @brief Get all `Translation ID`s
+    std::vector<std::string> getIds() const
+    {
+        std::vector<std::string> ids;
+        for (const auto& var : translations_)
+            ids.push_back(var.first.str());
+        return ids;
+    }
+
+    /// @brief Add a pair of the `Translation ID` and `Translation text`.
+    /// @note If the given `Translation ID` already exists, do nothing.
+    void add(const std::string& tranId, const std::string& translation) { insert(tranId, translation); }
+
+    /// @brief Add a `Translation ID` and its plural forms {Plural category name : Translation text}.
+    /// @note - The plural category names are the CLDR's "zero", "one", "two", "few", "many" and "other".
+    /// @note - If the given `Translation ID` already exists or there is not any valid plural form, do nothing.
+    void addPlural(const std::string& tranId, const std::map<std::string, std::string>& forms)
+    {
+        detail::Entry entry = detail::Entry::fromPluralForms(forms);
+        if (!entry.plural)
+            return;
+        insert(tranId, std::move(entry));
+    }
+
+    /// @brief Remove a `Translation ID` and it corresponding `Translation text`.
+    void remove(const std::string& tranId)
+    {
+        const detail::TranslationItem* item =
+            index_.find(detail::hash(tranId.c_str(), tranId.size()), tranId.c_str(), tranId.size());
+        if (item)
+        {
+            auto it = translations_.find(item->first);
+            index_.erase(item);
+            translations_.erase(it);
+        }
+    }
+
+    /// @brief Remove all `Translation ID`s and it corresponding `Translation text`s.
+    void clear()
+    {
+        index_.clear();
+        translations_.clear();
+        namespaces_.clear();
+    }
+
+private:
+    /// @brief Load the `Translations` from a json file, the `prefix` is prepended to the `Translation ID`s.
+    static Translations fromFile(const std::string& filename, const std::string& prefix)
+    {
+        using Json = nlohmann::json;
+
+        std::ifstream ifs(filename);
+        if (!ifs.is_open())
+            return Translations();
+
+        Json j = Json::parse(ifs, nullptr, false, true);
+        if (j.is_discarded())
+        {
+            ifs.close();
+            return Translations();
+        }
+
+        ifs.close();
+        return fromJsonObject(j, prefix);
+    }
+
+    /// @brief Load the `Translations` from a json object, the values that are neither the `Translation text`
+    /// nor the plural forms are ignored.
+    /// @param prefix The prefix of all `Translation ID`s, it is the namespace of the file of the split `Translations`.
+    static Translations fromJsonObject(const nlohmann::json& j, const std::string& prefix = std::string())
+    {
+        Translations trans;
+        if (!j.is_object())
+            return trans;
+
+        auto add = [&trans](const std::string& tranId, const nlohmann::json& value) {
+            detail::Entry entry;
+            if (detail::entryFromJson(value, entry))
+                trans.insert(tranId, std::move(entry));
+        };
+        detail::forEachJsonEntry(j, prefix, add);
+        return trans;
+    }
+
+    /// @brief Write the `Translation ID`s and their entries in the order of the whole `Translation ID`.
+    void writeJson(detail::JsonWriter& writer) const
+    {
+        std::vector<const detail::TranslationItem*> items;
+        items.reserve(translations_.size());
+        for (const auto& var : translations_)
+            items.push_back(&var);
+        std::sort(items.begin(), items.end(),
+                  [](const detail::TranslationItem* lhs, const detail::TranslationItem* rhs) {
+                      return lhs->first.precedes(rhs->first);
+                  });
+
+        writer.beginObject();
+        for (const detail::TranslationItem* item : items)
+        {
+            writer.key(item->first.space(), item->first.name());
+            detail::writeEntryJson(writer, item->second);
+        }
+        writer.endObject();
+    }
+
+    /// @brief Add the `Translation ID` and its entry, its namespace is shared with the added `Translation ID`s.
+    /// @note If the given `Translation ID` already exists, do nothing.
+    void insert(const std::string& tranId, detail::Entry entry)
+    {
+        size_t pos = tranId.rfind('.');
+        size_t split = pos == std::string::npos ? 0 : pos + 1;
+        const std::string* space = &*namespaces_.insert(tranId.substr(0, split)).first;
+        auto ret = translations_.insert({ detail::TranslationKey(space, tranId.substr(split)), std::move(entry) });
+        if (ret.second)
+            index_.insert(&*ret.first);
+    }
+
+    /// @brief Add the `Translation ID`s of the other `Translations` that not exist.
+    void copyFrom(const Translations& other)
+    {
+        for (const auto& var : other.translations_)
+        {
+            const std::string* space = &*namespaces_.insert(var.first.space()).first;
+            auto ret = translations_.insert({ detail::TranslationKey(space, var.first.name()), var.second });
+            if (ret.second)
+                index_.insert(&*ret.first);
+        }
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` and it hash, if not exists return nullptr.
+    const char* find(const char* tranId, size_t len, uint64_t hash) const
+    {
+        const detail::TranslationItem* item = index_.find(hash, tranId, len);
+        return item ? item->second.text.c_str() : nullptr;
+    }
+
+    /// @brief Prefetch the index slot of the given `Translation ID` hash.
+    void prefetch(uint64_t hash) const { index_.prefetch(hash); }
+
+    /// @brief Get the first item whose key is not less than the key of the given namespace and name.
+    std::map<detail::TranslationKey, detail::Entry>::const_iterator
+    lowerBound(std::set<std::string>::const_iterator space, const std::string& name) const
+    {
+        if (space == namespaces_.end())
+            return translations_.end();
+        return translations_.lower_bound(detail::TranslationKey(&*space, name));
+    }
+
+    // The namespaces of the `Translation ID`s, see the detail::TranslationKey.
+    std::set<std::string> namespaces_;
+    // {Translation ID : Translation text}, it is ordered by the namespace, then the name.
+    std::map<detail::TranslationKey, detail::Entry> translations_;
+    // Points into the nodes of #translations_.
+    detail::HashIndex index_;
+};
+
+// The `Translation ID`s that start with a prefix, see the Translations::withPrefix().
+// It consists of two runs of the ordered `Translations`: the `Translation ID`s whose names start with the
+// rest of the prefix in the namespace of the prefix, then the `Translation ID`s of the namespaces that start
+// with the prefix. (e.g. the "Settings.Net" matches the "Settings.Netmask" and the "Settings.Network.Proxy")
+class Translations::PrefixRange
+{
+    typedef std::map<detail::TranslationKey, detail::Entry>::const_iterator Iterator;
+
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef TranslationView value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const TranslationView* pointer;
+        typedef TranslationView reference;
+
+        TranslationView operator*() const { return TranslationView{ &it_->first, &it_->second }; }
+
+        iterator& operator++()
+        {
+            if (++it_ == firstEnd_)
+                it_ = second_;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const iterator& other) const { return it_ == other.it_; }
+
+        bool operator!=(const iterator& other) const { return it_ != other.it_; }
+
+    private:
+        friend class PrefixRange;
+
+        iterator(Iterator it, Iterator firstEnd, Iterator second) : it_(it), firstEnd_(firstEnd), second_(second) {}
+
+        Iterator it_;
+        Iterator firstEnd_;
+        Iterator second_;
+    };
+
+    iterator begin() const
+    { return iterator(firstBegin_ != firstEnd_ ? firstBegin_ : secondBegin_, firstEnd_, secondBegin_); }
+
+    iterator end() const { return iterator(secondEnd_, firstEnd_, secondBegin_); }
+
+    bool empty() const { return firstBegin_ == firstEnd_ && secondBegin_ == secondEnd_; }
+
+    /// @brief Get the number of the `Translation ID`s, it iterates the range.
+    size_t count() const { return static_cast<size_t>(std::distance(begin(), end())); }
+
+private:
+    friend class Translations;
+
+    PrefixRange(Iterator firstBegin, Iterator firstEnd, Iterator secondBegin, Iterator secondEnd)
+        : firstBegin_(firstBegin), firstEnd_(firstEnd), secondBegin_(secondBegin), secondEnd_(secondEnd)
+    {}
+
+    Iterator firstBegin_;
+    Iterator firstEnd_;
+    Iterator secondBegin_;
+    Iterator secondEnd_;
+};
+
+inline Translations::PrefixRange Translations::withPrefix(const std::string& prefix) const
+{
+    // The '\xFF' is never in the UTF-8, so the strings that start with the `s` are less than the `s + '\xFF'`.
+    const std::string last(1, '\xFF');
+
+    // The `Translation ID`s in the namespace of the prefix whose names start with the rest of the prefix.
+    size_t pos = prefix.rfind('.');
+    size_t split = pos == std::string::npos ? 0 : pos + 1;
+    auto firstBegin = translations_.end();
+    auto firstEnd = translations_.end();
+    if (split < prefix.size())
+    {
+        auto space = namespaces_.find(prefix.substr(0, split));
+        std::string rest = prefix.substr(split);
+        firstBegin = lowerBound(space, rest);
+        firstEnd = lowerBound(space, rest + last);
+    }
+
+    // The `Translation ID`s of the namespaces that start with the prefix.
+    auto secondBegin = lowerBound(namespaces_.lower_bound(prefix), std::string());
+    auto secondEnd = lowerBound(namespaces_.lower_bound(prefix + last), std::string());
+
+    // The end of the first run is never reached in the second run.
+    if (firstBegin == firstEnd)
+        firstBegin = firstEnd = secondBegin;
+    return PrefixRange(firstBegin, firstEnd, secondBegin, secondEnd);
+}
+
+// A small table of the overridden `Translation text`s on a shared immutable base `Translations`.
+// (e.g. the branding overrides of each tenant on the same catalog)
+//   - The copy of an `Overlay` copies only its overrides, the base is shared by the reference counting.
+//   - A lookup checks a compact bloom filter of the overrides first, so the `Translation ID`s that are not
+//     overridden go to the base after a single bit test.
+//   - The memory of an `Overlay` scales with the number of its overrides, not the size of the base.
+class Overlay
+{
+public:
+    Overlay() : base_(std::make_shared<const Translations>()) {}
+
+    explicit Overlay(std::shared_ptr<const Translations> base)
+        : base_(base ? std::move(base) : std::make_shared<const Translations>())
+    {}
+
+    Overlay(std::shared_ptr<const Translations> base, const Translations& overrides)
+        : base_(base ? std::move(base) : std::make_shared<const Translations>()), overrides_(overrides)
+    { rebuildFilter(); }
+
+    /// @brief Load the overrides of an `Overlay` from a json file. (see the Translations::fromFile())
+    static Overlay fromFile(std::shared_ptr<const Translations> base, const std::string& filename)
+    { return Overlay(std::move(base), Translations::fromFile(filename)); }
+
+    /// @brief Get the shared base `Translations`.
+    const std::shared_ptr<const Translations>& base() const { return base_; }
+
+    /// @brief Get the overridden `Translation text`s.
+    const Translations& overrides() const { return overrides_; }
+
+    /// @brief Get the `Translation text` of the given `Translation ID`, the overridden one if it is overridden.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    const char* at(const std::string& tranId) const { return view(tranId.c_str(), tranId.size()).data; }
+
+    /// @brief Get the `Translation text` of the given `Translation ID`, the overridden one if it is overridden.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    const char* at(const char* tranId) const { return view(tranId, std::strlen(tranId)).data; }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` with its length. (see the #at())
+    TextView view(const std::string& tranId) const { return view(tranId.c_str(), tranId.size()); }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` with its length. (see the #at())
+    TextView view(const char* tranId, size_t len) const
+    {
+        const detail::Entry* entry = find(tranId, len, detail::hash(tranId, len));
+        return entry ? TextView{ entry->text.c_str(), entry->text.size() } : TextView{ tranId, len };
+    }
+
+    /// @brief Check whether exists the given `Translation ID` on the overrides or the base.
+    bool has(const std::string& tranId) const
+    { return find(tranId.c_str(), tranId.size(), detail::hash(tranId.c_str(), tranId.size())) != nullptr; }
+
+    /// @brief Check whether the given `Translation ID` is overridden.
+    bool overridden(const std::string& tranId) const { return overrides_.has(tranId); }
+
+    /// @brief Get the number of the overridden `Translation ID`.
+    size_t overrideCount() const { return overrides_.count(); }
+
+    /// @brief Override the `Translation text` of the given `Translation ID`.
+    /// @note If the given `Translation ID` already overridden, replace it.
+    void add(const std::string& tranId, const std::string& translation)
+    {
+        overrides_.remove(tranId);
+        overrides_.add(tranId, translation);
+        if (overrides_.count() * bitsPerOverride > filter_.size() * 64)
+            rebuildFilter();
+        else
+            setFilter(detail::hash(tranId.c_str(), tranId.size()));
+    }
+
+    /// @brief Remove the override of the given `Translation ID`, it is looked up on the base again.
+    void remove(const std::string& tranId)
+    {
+        if (!overrides_.has(tranId))
+            return;
+        overrides_.remove(tranId);
+        rebuildFilter();
+    }
+
+    /// @brief Remove all overrides.
+    void clear()
+    {
+        overrides_.clear();
+        filter_.clear();
+    }
+
+private:
+    static constexpr size_t bitsPerOverride = 16;
+
+    /// @brief Get the entry of the given `Translation ID` and it hash, if not exists return nullptr.
+    const detail::Entry* find(const char* tranId, size_t len, uint64_t hash) const
+    {
+        const detail::TranslationItem* item = nullptr;
+        if (mayBeOverridden(hash))
+            item = overrides_.index_.find(hash, tranId, len);
+        if (!item)
+            item = base_->index_.find(hash, tranId, len);
+        return item ? &item->second : nullptr;
+    }
+
+    bool mayBeOverridden(uint64_t hash) const
+    {
+        if (filter_.empty())
+            return false;
+        size_t mask = filter_.size() * 64 - 1;
+        size_t a = static_cast<size_t>(hash) & mask;
+        size_t b = static_cast<size_t>(hash >> 32) & mask;
+        return (filter_[a / 64] >> (a % 64) & 1) && (filter_[b / 64] >> (b % 64) & 1);
+    }
+
+    void setFilter(uint64_t hash)
+    {
+        size_t mask = filter_.size() * 64 - 1;
+        size_t a = static_cast<size_t>(hash) & mask;
+        size_t b = static_cast<size_t>(hash >> 32) & mask;
+        filter_[a / 64] |= 1ULL << (a % 64);
+        filter_[b / 64] |= 1ULL << (b % 64);
+    }
+
+    void rebuildFilter()
+    {
+        filter_.clear();
+        if (overrides_.empty())
+            return;
+
+        size_t words = 1;
+        while (words * 64 < overrides_.count() * bitsPerOverride)
+            words *= 2;
+        filter_.assign(words, 0);
+        for (const auto& var : overrides_.translations_)
+            setFilter(var.first.hash());
+    }
+
+    std::shared_ptr<const Translations> base_;
+    Translations overrides_;
+    // The bloom filter of the `Translation ID`s of the #overrides_, its bits are the power of 2.
+    std::vector<uint64_t> filter_;
+};
+
+namespace detail
+{
+
+// The tables of an easytr::EmbeddedCatalog that built from the `Translations`.
+struct CatalogTables
+{
+    std::string strings;
+    std::vector<EmbeddedEntry> entries;
+    // See the EmbeddedCatalog::slots.
+    std::vector<uint32_t> slots;
+
+    /// @brief Add the `Translation ID` and its `Translation text` (or a plural form of it).
+    /// @param id The offset of the `Translation ID` in the #strings, the `Translation ID` is added if it is
+    /// the end of the #strings. (the plural forms share the `Translation ID`)
+    void add(const TranslationView& item, const std::string& text, uint8_t form, uint32_t id)
+    {
+        std::string tranId = item.id();
+        if (id == strings.size())
+            strings.append(tranId).push_back('\0');
+
+        EmbeddedEntry entry;
+        entry.hash = hash(tranId.c_str(), tranId.size());
+        entry.id = id;
+        entry.idLength = static_cast<uint32_t>(tranId.size());
+        entry.spaceLength = static_cast<uint32_t>(item.space().size());
+        entry.text = static_cast<uint32_t>(strings.size());
+        entry.textLength = static_cast<uint32_t>(text.size());
+        entry.form = form;
+        strings.append(text).push_back('\0');
+        entries.push_back(entry);
+    }
+};
+
+/// @brief Build the tables of an easytr::EmbeddedCatalog from the `Translations`, ordered and hashed like the
+/// `Translations`, and the hash table of them that is loaded like the detail::HashIndex.
+/// (see the Translations::fromEmbedded())
+inline CatalogTables buildCatalog(const Translations& translations)
+{
+    CatalogTables tables;
+    for (const auto& item : translations.withPrefix(""))
+    {
+        uint32_t id = static_cast<uint32_t>(tables.strings.size());
+        if (!item.entry->plural)
+        {
+            tables.add(item, item.entry->text, PLURAL_COUNT, id);
+            continue;
+        }
+        for (uint8_t form = 0; form < PLURAL_COUNT; ++form)
+        {
+            if (item.entry->plural->given & (1u << form))
+                tables.add(item, item.entry->plural->forms[form].text, form, id);
+        }
+    }
+
+    size_t capacity = 16;
+    while (translations.count() * 2 > capacity)
+        capacity *= 2;
+    tables.slots.assign(capacity, 0);
+    for (size_t i = 0; i < tables.entries.size(); ++i)
+    {
+        if (i > 0 && tables.entries[i].id == tables.entries[i - 1].id)
+            continue;
+        size_t slot = tables.entries[i].hash & (capacity - 1);
+        while (tables.slots[slot] != 0)
+            slot = (slot + 1) & (capacity - 1);
+        tables.slots[slot] = static_cast<uint32_t>(i + 1);
+    }
+    return tables;
+}
+
+} // namespace detail
+
+// A single file that packs the `Translations` of many languages (the catalogs) as the tables of the
+// easytr::EmbeddedCatalog, so a language is loaded from the mapping of the file without the file I/O and json
+// parsing. (see the BundleSource)
+//
+// The layout of the file (in the native byte order):
+//   Header | Index[count] | for each catalog: the name, the (8-aligned) entries and the strings.
+class Bundle
+{
+public:
+    /// @brief Open a bundle file and map it into the memory (read it into the memory once on the platforms
+    /// without the mmap).
+    /// @return If the file is not exists or not a valid bundle return nullptr.
+    static std::shared_ptr<const Bundle> open(const std::string& filename)
+    {
+        std::shared_ptr<Bundle> bundle(new Bundle());
+        bundle->filename_ = filename;
+
+#ifdef EASY_TRANSLATE_POSIX
+        int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+        bundle->data_ = static_cast<const char*>(data);
+        bundle->size_ = static_cast<size_t>(st.st_size);
+        bundle->mapped_ = true;
+#else
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs.is_open())
+            return nullptr;
+        bundle->buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        bundle->data_ = bundle->buffer_.data();
+        bundle->size_ = bundle->buffer_.size();
+#endif // EASY_TRANSLATE_POSIX
+
+        if (!bundle->parse())
+            return nullptr;
+        return bundle;
+    }
+
+    /// @brief Write the catalogs {Catalog name : Translations} to a bundle file.
+    /// @return If failed to write the file return false else return true.
+    static bool write(const std::string& filename, const std::map<std::string, Translations>& catalogs)
+    {
+        std::vector<detail::CatalogTables> tables;
+        std::vector<Index> indexes;
+        tables.reserve(catalogs.size());
+        indexes.reserve(catalogs.size());
+
+        uint64_t offset = sizeof(Header) + catalogs.size() * sizeof(Index);
+        for (const auto& var : catalogs)
+        {
+            tables.push_back(detail::buildCatalog(var.second));
+            Index index;
+            index.name = offset;
+            index.nameLength = var.first.size();
+            offset = align(offset + index.nameLength);
+            index.entries = offset;
+            index.count = tables.back().entries.size();
+            offset += index.count * sizeof(EmbeddedEntry);
+            index.strings = offset;
+            index.stringsSize = tables.back().strings.size();
+            offset += index.stringsSize;
+            indexes.push_back(index);
+        }
+
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.version = VERSION;
+        header.count = catalogs.size();
+
+        // The bundle is replaced atomically, so the mappings of the old file stay valid.
+        detail::AtomicFile file(filename);
+        bool ok = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+                  file.write(reinterpret_cast<const char*>(indexes.data()), indexes.size() * sizeof(Index));
+
+        static const char padding[ALIGNMENT] = {};
+        size_t i = 0;
+        for (const auto& var : catalogs)
+        {
+            uint64_t end = indexes[i].name + indexes[i].nameLength;
+            const auto& table = tables[i++];
+            ok = ok && file.write(var.first.data(), var.first.size()) &&
+                 file.write(padding, static_cast<size_t>(align(end) - end)) &&
+                 file.write(reinterpret_cast<const char*>(table.entries.data()),
+                            table.entries.size() * sizeof(EmbeddedEntry)) &&
+                 file.write(table.strings.data(), table.strings.size());
+        }
+
+        return ok && file.commit();
+    }
+
+    ~Bundle()
+    {
+#ifdef EASY_TRANSLATE_POSIX
+        if (mapped_)
+            munmap(const_cast<char*>(data_), size_);
+#endif // EASY_TRANSLATE_POSIX
+    }
+
+    Bundle(const Bundle&) = delete;
+    Bundle& operator=(const Bundle&) = delete;
+
+    const std::string& filename() const { return filename_; }
+
+    size_t count() const { return catalogs_.size(); }
+
+    bool has(const std::string& name) const { return catalogs_.find(name) != catalogs_.end(); }
+
+    /// @brief Get the names of all catalogs.
+    std::vector<std::string> names() const
+    {
+        std::vector<std::string> names;
+        names.reserve(catalogs_.size());
+        for (const auto& var : catalogs_)
+            names.push_back(var.first);
+        return names;
+    }
+
+    /// @brief Load the `Translations` of the given catalog from the mapping. (see the Translations::fromEmbedded())
+    /// @note If the catalog is not exists or its entries are out of the range, the `Translations` will be empty.
+    Translations translations(const std::string& name) const
+    {
+        auto it = catalogs_.find(name);
+        if (it == catalogs_.end())
+            return Translations();
+
+        const EmbeddedCatalog& catalog = it->second.catalog;
+        uint64_t size = it->second.stringsSize;
+        for (size_t i = 0; i < catalog.count; ++i)
+        {
+            const EmbeddedEntry& entry = catalog.entries[i];
+            if (entry.form > detail::PLURAL_COUNT || entry.spaceLength > entry.idLength ||
+                uint64_t(entry.id) + entry.idLength > size || uint64_t(entry.text) + entry.textLength > size)
+                return Translations();
+        }
+        return Translations::fromEmbedded(catalog);
+    }
+
+private:
+    static_assert(sizeof(EmbeddedEntry) == 32, "The bundle file stores the easytr::EmbeddedEntry as is.");
+
+    static constexpr const char* MAGIC = "EASYTRBD";
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t ALIGNMENT = 8;
+
+    struct Header
+    {
+        char magic[8];
+        // The bundle written on a platform of the other byte order is invalid.
+        uint32_t byteOrder;
+        uint32_t version;
+        // The number of the catalogs.
+        uint64_t count;
+    };
+
+    // The offsets are from the begin of the file.
+    struct Index
+    {
+        uint64_t name;
+        uint64_t nameLength;
+        uint64_t entries;
+        uint64_t count;
+        uint64_t strings;
+        uint64_t stringsSize;
+    };
+
+    struct Catalog
+    {
+        EmbeddedCatalog catalog;
+        uint64_t stringsSize;
+    };
+
+    Bundle() = default;
+
+    static uint64_t align(uint64_t offset) { return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+    bool inRange(uint64_t offset, uint64_t length) const { return offset <= size_ && length <= size_ - offset; }
+
+    /// @brief Read the header and index, the catalogs refer to the mapping.
+    /// @return If the file is not a valid bundle return false else return true.
+    bool parse()
+    {
+        Header header;
+        if (size_ < sizeof(header))
+            return false;
+        std::memcpy(&header, data_, sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 || header.byteOrder != BYTE_ORDER_MARK ||
+            header.version != VERSION || header.count > (size_ - sizeof(header)) / sizeof(Index))
+            return false;
+
+        for (uint64_t i = 0; i < header.count; ++i)
+        {
+            Index index;
+            std::memcpy(&index, data_ + sizeof(header) + i * sizeof(Index), sizeof(index));
+            if (!inRange(index.name, index.nameLength) || index.entries % ALIGNMENT != 0 ||
+                !inRange(index.entries, 0) || index.count > (size_ - index.entries) / sizeof(EmbeddedEntry) ||
+                !inRange(index.strings, index.stringsSize))
+                return false;
+
+            auto it = catalogs_.insert({ std::string(data_ + index.name, index.nameLength), Catalog() }).first;
+            it->second.catalog.name = it->first.c_str();
+            it->second.catalog.strings = data_ + index.strings;
+            it->second.catalog.entries = reinterpret_cast<const EmbeddedEntry*>(data_ + index.entries);
+            it->second.catalog.count = index.count;
+            it->second.stringsSize = index.stringsSize;
+        }
+        return true;
+    }
+
+    std::string filename_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    // The content of the file on the platforms without the mmap.
+    std::vector<char> buffer_;
+    // {Catalog name : Catalog}, the tables refer to the #data_.
+    std::map<std::string, Catalog> catalogs_;
+};
+
+// Load the `Translations` from a `Translations file`.
+class FileSource : public TranslationsSource
+{
+public:
+    explicit FileSource(std::string filename) : filename_(std::move(filename)) {}
+
+    Translations load() const override { return Translations::fromFile(filename_); }
+
+    std::string name() const override { return filename_; }
+
+    nlohmann::json toJson() const override { return filename_; }
+
+private:
+    std::string filename_;
+};
+
+// Load the `Translations` from a json in the memory, e.g. a resource that linked into the binary.
+// It can not be written to the `Languages file`.
+class MemorySource : public TranslationsSource
+{
+public:
+    /// @brief Use a copy of the json string.
+    explicit MemorySource(std::string json) : json_(std::move(json)) {}
+
+    /// @brief Use the json buffer without copy.
+    /// @attention The buffer should outlive the source.
+    MemorySource(const char* data, size_t size) : data_(data), size_(size) {}
+
+    Translations load() const override
+    { return data_ ? Translations::fromJson(data_, size_) : Translations::fromJson(json_); }
+
+    std::string name() const override { return "<memory>"; }
+
+private:
+    std::string json_;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Load the `Translations` from a catalog of a Bundle, the languages that share a bundle share its mapping.
+class BundleSource : public TranslationsSource
+{
+public:
+    /// @param bundle The opened bundle, if it is nullptr the `Translations` will be empty.
+    BundleSource(std::shared_ptr<const Bundle> bundle, std::string catalogName)
+        : BundleSource(bundle ? bundle->filename() : std::string(), bundle, std::move(catalogName))
+    {}
+
+    /// @brief Open the bundle file, if failed the `Translations` will be empty. (see the Bundle::open())
+    BundleSource(const std::string& filename, std::string catalogName)
+        : BundleSource(filename, Bundle::open(filename), std::move(catalogName))
+    {}
+
+    /// @param filename The filename of the bundle, that is written to the `Languages file`.
+    /// @param bundle The opened bundle, if it is nullptr the `Translations` will be empty.
+    BundleSource(std::string filename, std::shared_ptr<const Bundle> bundle, std::string catalogName)
+        : filename_(std::move(filename)), bundle_(std::move(bundle)), catalogName_(std::move(catalogName))
+    {}
+
+    Translations load() const override
+    { return bundle_ ? bundle_->translations(catalogName_) : Translations(); }
+
+    std::string name() const override { return filename_ + "#" + catalogName_; }
+
+    nlohmann::json toJson() const override { return { { "bundle", filename_ }, { "entry", catalogName_ } }; }
+
+    const std::shared_ptr<const Bundle>& bundle() const { return bundle_; }
+
+private:
+    std::string filename_;
+    std::shared_ptr<const Bundle> bundle_;
+    std::string catalogName_;
+};
+
+inline Languages Languages::fromJsonObject(const nlohmann::json& j)
+{
+    Languages langs;
+    if (!j.is_object())
+        return langs;
+
+    // {Bundle filename : Bundle}, the languages of a bundle share its mapping.
+    std::map<std::string, std::shared_ptr<const Bundle>> bundles;
+
+    for (const auto& var : j.items())
+    {
+        const auto& value = var.value();
+        if (value.is_string())
+        {
+            langs.languages_.insert({ var.key(), value.get<std::string>() });
+        }
+        else if (value.is_object() && value.contains("manifest") && value["manifest"].is_string())
+        {
+            langs.addManifest(var.key(), value["manifest"].get<std::string>());
+        }
+        else if (value.is_object() && value.contains("embedded") && value["embedded"].is_string())
+        {
+            langs.addEmbedded(var.key(), value["embedded"].get<std::string>());
+        }
+        else if (value.is_object() && value.contains("bundle") && value["bundle"].is_string())
+        {
+            std::string filename = value["bundle"].get<std::string>();
+            std::string entry = value.contains("entry") && value["entry"].is_string() ?
+                value["entry"].get<std::string>() : var.key();
+            auto bundle = bundles.find(filename);
+            if (bundle == bundles.end())
+                bundle = bundles.insert({ filename, Bundle::open(filename) }).first;
+            langs.addSource(var.key(), std::make_shared<BundleSource>(filename, bundle->second, entry));
+        }
+        else if (value.is_object() && value.contains("file") && value["file"].is_string())
+        {
+            langs.languages_.insert({ var.key(), value["file"].get<std::string>() });
+        }
+
+        if (value.is_object() && langs.has(var.key()))
+        {
+            if (value.contains("fallback") && value["fallback"].is_string())
+                langs.setFallback(var.key(), value["fallback"].get<std::string>());
+            if (value.contains("base") && value["base"].is_string())
+                langs.setBase(var.key(), value["base"].get<std::string>());
+        }
+    }
+    return langs;
+}
+
+/// @brief A named argument of the easytr::format(), it refers to the value without copy.
+template <typename T>
+struct NamedArg
+{
+    const char* name;
+    const T& value;
+};
+
+/// @brief Make a named argument for the `{name}` placeholder of the easytr::format().
+template <typename T>
+inline NamedArg<T> arg(const char* name, const T& value)
+{ return NamedArg<T>{ name, value }; }
+
+namespace detail
+{
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value &&
+                               !std::is_same<T, char>::value, FormatArg>::type
+makeFormatArg(const T& value)
+{ return FormatArg(static_cast<long long>(value)); }
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value &&
+                               !std::is_same<T, bool>::value && !std::is_same<T, char>::value, FormatArg>::type
+makeFormatArg(const T& value)
+{ return FormatArg(static_cast<unsigned long long>(value)); }
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, FormatArg>::type
+makeFormatArg(const T& value)
+{ return FormatArg(static_cast<double>(value)); }
+
+inline FormatArg makeFormatArg(bool value)
+{ return value ? FormatArg("true", 4) : FormatArg("false", 5); }
+
+inline FormatArg makeFormatArg(const char& value)
+{ return FormatArg(&value, 1); }
+
+inline FormatArg makeFormatArg(const char* value)
+{ return FormatArg(value, std::strlen(value)); }
+
+inline FormatArg makeFormatArg(const std::string& value)
+{ return FormatArg(value.data(), value.size()); }
+
+template <typename T>
+inline FormatArg makeFormatArg(const NamedArg<T>& value)
+{
+    FormatArg arg = makeFormatArg(value.value);
+    arg.name = value.name;
+    arg.nameLen = std::strlen(value.name);
+    return arg;
+}
+
+} // namespace detail
+
+/// @brief The result of the easytr::format(), the short text is stored inline without allocate memory.
+class FormattedText
+{
+    friend class TranslateManager;
+
+public:
+    static constexpr size_t inlineCapacity = 256;
+
+    FormattedText() { inline_[0] = '\0'; }
+
+    FormattedText(const FormattedText& other)
+    {
+        inline_[0] = '\0';
+        *this = other;
+    }
+
+    FormattedText(FormattedText&& other) noexcept
+    {
+        inline_[0] = '\0';
+        *this = std::move(other);
+    }
+
+    FormattedText& operator=(const FormattedText& other)
+    {
+        if (this != &other)
+        {
+            size_ = other.size_;
+            if (other.heap_)
+            {
+                heap_.reset(new char[size_ + 1]);
+                std::memcpy(heap_.get(), other.heap_.get(), size_ + 1);
+            }
+            else
+            {
+                heap_.reset();
+                std::memcpy(inline_, other.inline_, size_ + 1);
+            }
+        }
+        return *this;
+    }
+
+    FormattedText& operator=(FormattedText&& other) noexcept
+    {
+        if (this != &other)
+        {
+            size_ = other.size_;
+            heap_ = std::move(other.heap_);
+            if (!heap_)
+                std::memcpy(inline_, other.inline_, size_ + 1);
+            // The moved text is left empty.
+            other.size_ = 0;
+            other.inline_[0] = '\0';
+        }
+        return *this;
+    }
+
+    /// @brief Get the null-terminated text.
+    const char* c_str() const { return heap_ ? heap_.get() : inline_; }
+
+    const char* data() const { return c_str(); }
+
+    /// @brief Get the length of the text.
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    std::string str() const { return std::string(c_str(), size_); }
+
+private:
+    char inline_[inlineCapacity];
+    std::unique_ptr<char[]> heap_;
+    size_t size_ = 0;
+};
+
+/// @brief The result of the TranslateManager::updateTranslationsFiles().
+struct UpdateReport
+{
+    // The number of the `Translations file`s that are rewritten.
+    size_t changed = 0;
+    // The number of the `Translations file`s that are already up to date, they are not rewritten.
+    size_t unchanged = 0;
+    // The number of the `Translations file`s that failed to update.
+    size_t failed = 0;
+};
+
+#ifdef EASY_TRANSLATE_MISSING_LOG
+/// @brief A pair of the `Language ID` and `Translation ID` that is missing on the language.
+struct MissingTranslation
+{
+    std::string languageId;
+    std::string tranId;
+};
+#endif // EASY_TRANSLATE_MISSING_LOG
+
+// Singleton class
+class TranslateManager
+{
+    // It pins the `Snapshot` while it converts the `Translation text`, see the easy_translate_qt.hpp.
+    friend class QtTranslator;
+public:
+    static TranslateManager& getInstance()
+    {
+        static TranslateManager instance;
+        return instance;
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` on current language.
+    /// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+    const char* translate(const std::string& tranId) const
+    {
+        recordId(tranId.c_str());
+        ReadGuard guard(*this);
+        return translate(guard.snapshot(), tranId.c_str(), tranId.size());
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` on current language.
+    /// @note - If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+    /// @note - The returned `Translation text` is valid until the current language is changed twice.
+    const char* translate(const char* tranId) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        return translate(guard.snapshot(), tranId, std::strlen(tranId));
+    }
+
+    /// @brief Get the `Translation text`s of the given `Translation ID`s on current language.
+    /// @param tranIds The `Translation ID`s, its size should be equal to the `count`.
+    /// @param texts The output `Translation text`s, its size should be equal to the `count`.
+    /// @note - All `Translation ID`s are resolved on the same language, even if the current language
+    /// is changed by other thread at the same time. (the language is pinned during the lookups)
+    /// @note - If a `Translation ID` is not exist on the current language, its `Translation text` is
+    /// the `Translation ID` itself.
+    void translate(const char* const* tranIds, size_t count, const char** texts) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            recordId(tranIds[i]);
+        ReadGuard guard(*this);
+        translate(guard.snapshot(), tranIds, count, texts);
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` on current language with its length,
+    /// the length is stored in the `Translations` so it needs not count the text again.
+    /// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+    TextView translateView(const std::string& tranId) const
+    {
+        recordId(tranId.c_str());
+        ReadGuard guard(*this);
+        return translateView(guard.snapshot(), tranId.c_str(), tranId.size());
+    }
+
+    /// @brief Get the `Translation text` of the given `Translation ID` on current language with its length,
+    /// the length is stored in the `Translations` so it needs not count the text again.
+    /// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+    TextView translateView(const char* tranId) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        return translateView(guard.snapshot(), tranId, std::strlen(tranId));
+    }
+
+#ifdef EASY_TRANSLATE_UTF16
+    /// @brief Get the UTF-16 `Translation text` of the given `Translation ID` on current language.
+    /// @note - The UTF-16 `Translation text`s are transcoded once when the `Translations` is loaded, so the
+    /// consumers of the UTF-16 (e.g. QString) can wrap them without transcoding again.
+    /// @note - The returned view is valid until the current language is changed twice, like the #translate().
+    /// @note - If the given `Translation ID` is not exist on the current language, return the UTF-16
+    /// `Translation ID`.
+    std::u16string_view translateU16(const std::string& tranId) const
+    {
+        recordId(tranId.c_str());
+        ReadGuard guard(*this);
+        return translateU16(guard.snapshot(), tranId.c_str(), tranId.size());
+    }
+
+    /// @brief Get the UTF-16 `Translation text` of the given `Translation ID` on current language.
+    /// @note - The UTF-16 `Translation text`s are transcoded once when the `Translations` is loaded, so the
+    /// consumers of the UTF-16 (e.g. QString) can wrap them without transcoding again.
+    /// @note - The returned view is valid until the current language is changed twice, like the #translate().
+    /// @note - If the given `Translation ID` is not exist on the current language, return the UTF-16
+    /// `Translation ID`.
+    std::u16string_view translateU16(const char* tranId) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        return translateU16(guard.snapshot(), tranId, std::strlen(tranId));
+    }
+#endif // EASY_TRANSLATE_UTF16
+
+    /// @brief Get the `Translation text` of the given `Translation ID` on current language, and replace its
+    /// placeholders with the arguments.
+    /// @note - The placeholder is `{index}` for the positional argument, or `{name}` for the named argument
+    /// (see the easytr::arg()), so the translators can reorder the arguments. The `{{` and `}}` are the
+    /// escaped `{` and `}`.
+    /// @note - The placeholders of the `Translation text` are parsed once when the `Translations` is loaded.
+    /// @note - If the given `Translation ID` is not exist on the current language, format the `Translation ID` itself.
+    template <typename... Args>
+    FormattedText format(const char* tranId, const Args&... args) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        const Snapshot& snapshot = guard.snapshot();
+        size_t len = std::strlen(tranId);
+        const detail::FormatArg list[] = { detail::makeFormatArg(args)..., detail::FormatArg(0ULL) };
+        return formatArgs(snapshot.pluralRule, lookup(snapshot, tranId, len), tranId, len, list, sizeof...(Args));
+    }
+
+    /// @brief Format the `Translation text` of the given `Translation ID` on current language to the buffer,
+    /// see the #format().
+    /// @param capacity The size of the `buffer`, the formatted text is truncated to `capacity` - 1 bytes and
+    /// always null-terminated (if `capacity` > 0).
+    /// @return The length of the whole formatted text, if it is not less than the `capacity`, the text is truncated.
+    template <typename... Args>
+    size_t formatTo(char* buffer, size_t capacity, const char* tranId, const Args&... args) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        const Snapshot& snapshot = guard.snapshot();
+        size_t len = std::strlen(tranId);
+        const detail::FormatArg list[] = { detail::makeFormatArg(args)..., detail::FormatArg(0ULL) };
+        return formatTo(snapshot.pluralRule, lookup(snapshot, tranId, len), tranId, len, list, sizeof...(Args), buffer, capacity);
+    }
+
+    /// @brief Get the plural form of the `Translation text` of the given `Translation ID` on current language,
+    /// that is chosen by the count `n` and the plural rule of the current language.
+    /// @note - The plural forms are given by a json object {Plural category name : Translation text} in the
+    /// `Translations file`, the plural category names are the CLDR's "zero", "one", "two", "few", "many" and
+    /// "other", the forms that not given fall back to the "other" form.
+    /// @note - The plural rule is chosen by the primary language subtag of the `Language ID` (like "ru" of the
+    /// "ru_RU"), and the rule of English is used if it is unknown.
+    /// @note - If the `Translation text` has not plural forms, return it; if the given `Translation ID` is not
+    /// exist on the current language, return the `Translation ID` itself.
+    const char* translatePlural(const char* tranId, long long n) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        const detail::Entry* entry = lookupPlural(guard.snapshot(), tranId, std::strlen(tranId), n);
+        return entry ? entry->text.c_str() : tranId;
+    }
+
+    /// @brief Format the plural form of the `Translation text` of the given `Translation ID` on current language,
+    /// see the #translatePlural() and #format().
+    /// @note The count `n` only chooses the plural form, pass it to the arguments also if it is referred by
+    /// the placeholders.
+    template <typename... Args>
+    FormattedText formatPlural(const char* tranId, long long n, const Args&... args) const
+    {
+        recordId(tranId);
+        ReadGuard guard(*this);
+        const Snapshot& snapshot = guard.snapshot();
+        size_t len = std::strlen(tranId);
+        const detail::FormatArg list[] = { detail::makeFormatArg(args)..., detail::FormatArg(0ULL) };
+        return formatArgs(snapshot.pluralRule, lookupPlural(snapshot, tranId, len, n), tranId, len, list, sizeof...(Args));
+    }
+
+    /// @brief Set the `Languages`.
+    void setLanguages(const Languages& languages) { setLanguages(languages, std::string()); }
+
+    /// @brief Set the `Languages` that from a json file.
+    /// @note The file is watched by the hot reload, see the #startHotReload().
+    void setLanguages(const std::string& filename) { setLanguages(Languages::fromFile(filename), filename); }
+
+    /// @brief Get the `Language ID` of the current language.
+    const char* currentLanguage() const { return currentLanguageId_.load(std::memory_order_acquire)->c_str(); }
+
+    /// @brief Set the current language by `Language ID`.
+    /// @return If success to change return true else return false.
+    bool setCurrentLanguage(const std::string& languageId)
+    {
+        std::lock_guard<std::mutex> lock(languageMutex_);
+        return changeLanguage(languageId);
+    }
+
+    /// @brief Get a copy of the `Languages`.
+    /// @note It is a copy since the `Languages` may be replaced by the hot reload meanwhile.
+    Languages languages() const { return *publishedLanguages(); }
+
+    /// @brief Get the `Translations` of current language, not include the fallback and base languages.
+    /// @note - The `Translations` of the split language is empty, see the Languages::addManifest().
+    /// @note - The returned `Translations` is valid until the current language is changed twice, like the
+    /// #translate().
+    const Translations& translations() const
+    {
+        ReadGuard guard(*this);
+        return guard.snapshot().whole();
+    }
+
+    /// @brief Get the number of the `Language ID`.
+    size_t languageCount() const { return publishedLanguages()->count(); }
+
+    /// @brief Get the number of the `Translation ID` on current language, not include the fallback and base
+    /// languages.
+    size_t translationCount() const
+    {
+        ReadGuard guard(*this);
+        return guard.snapshot().count();
+    }
+
+    /// @brief Get the generation of the current `Translations`, it is increased each time the current
+    /// `Translations` is replaced (e.g. set the current language), so the caches of the `Translation text`s
+    /// (like the easytr::QtTranslator) know when to be cleared.
+    uint64_t generation() const
+    {
+        ReadGuard guard(*this);
+        return guard.snapshot().generation;
+    }
+
+    /// @brief Check whether exists the given `Language ID`.
+    bool hasLanguage(const std::string& languageId) const { return publishedLanguages()->has(languageId); }
+
+    /// @brief Check whether exists the given `Translation ID` on current language or its fallback and base
+    /// languages.
+    bool hasTranslation(const std::string& tranId) const
+    {
+        uint64_t hash = detail::hash(tranId.data(), tranId.size());
+        ReadGuard guard(*this);
+        for (const Snapshot* snapshot = &guard.snapshot(); snapshot; snapshot = snapshot->base.get())
+        {
+            if (snapshot->findEntry(hash, tranId.data(), tranId.size()))
+                return true;
+        }
+        return false;
+    }
+
+    /// @brief Update all `Translations file`s. (add pairs of the new `Translation ID` and empty `Translation text`)
+    /// @return The number of updated files. (the files that are unchanged are counted as updated)
+    /// @note - The new `Translation ID` is from all `Translation ID` that passed as #translate() function argument in programs,
+    /// or from all `Translation ID` that registered by the EASYTR() when define the macro \ref EASY_TRANSLATE_ID_REGISTRY.
+    /// @note - This function can help you to easy get the all `Translation ID` that need to translate.
+    /// @note - The delta files (see the Languages::setBase()) are not updated.
+    /// @note - The files are updated on the calling thread, use the #updateTranslationsFiles(size_t) to update
+    /// them in parallel.
+    /// @attention - Make sure to call this function after you already call all #translate() function,
+    /// if not you will get incomplete `Translation ID` list. (not required by the \ref EASY_TRANSLATE_ID_REGISTRY)
+    /// @attention - This function is not effect when undefine both the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+    /// and \ref EASY_TRANSLATE_ID_REGISTRY.
+    size_t updateTranslationsFiles() const
+    {
+        UpdateReport report = updateTranslationsFiles(1);
+        return report.changed + report.unchanged;
+    }
+
+    /// @brief Update all `Translations file`s in parallel. (see the #updateTranslationsFiles())
+    /// @param threadCount The number of the worker threads, 0 means the number of the hardware threads.
+    /// @return The number of changed, unchanged and failed files.
+    /// @note The file whose updated content is same as the content on disk is not rewritten.
+    /// @attention - This function is not effect when undefine both the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+    /// and \ref EASY_TRANSLATE_ID_REGISTRY.
+    UpdateReport updateTranslationsFiles(size_t threadCount) const
+    {
+    #ifndef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+        (void) threadCount;
+        return UpdateReport();
+    #else
+    #ifdef EASY_TRANSLATE_ID_REGISTRY
+        std::set<std::string> tranIds = registeredIds();
+        tranIds.insert(tranIds_.begin(), tranIds_.end());
+    #else
+        const std::set<std::string>& tranIds = tranIds_;
+    #endif // EASY_TRANSLATE_ID_REGISTRY
+
+        // {Translations filename : Translation IDs}
+        std::vector<std::pair<std::string, const std::set<std::string>*>> files;
+        // The `Translation ID`s of the files of the split languages, they omit the namespace.
+        std::vector<std::unique_ptr<std::set<std::string>>> splitIds;
+        std::shared_ptr<const Languages> languages = publishedLanguages();
+        for (const auto& var : languages->languages_)
+        {
+            // The delta files only have the overridden `Translation ID`s, so they are not updated. And the embedded
+            // catalogs and sources are not files that can be updated.
+            if (!languages->base(var.first).empty() || languages->isEmbedded(var.first) || languages->source(var.first))
+                continue;
+
+            if (!languages->isManifest(var.first))
+            {
+                files.push_back({ var.second, &tranIds });
+                continue;
+            }
+
+            std::map<std::string, std::string> manifest = detail::readManifest(var.second);
+            std::map<std::string, std::set<std::string>> ids = detail::splitTranslationIds(manifest, tranIds);
+            for (const auto& file : manifest)
+            {
+                splitIds.emplace_back(new std::set<std::string>(std::move(ids[file.first])));
+                files.push_back({ file.second, splitIds.back().get() });
+            }
+        }
+
+        std::vector<UpdateStatus> statuses(files.size(), UPDATE_FAILED);
+        std::vector<std::unique_ptr<detail::AtomicFile>> written(files.size());
+        detail::parallelFor(files.size(), threadCount, [&](size_t i) {
+            statuses[i] = updateTranslationsFile(files[i].first, *files[i].second, written[i]);
+        });
+
+        // The changed files are replaced together, so the syncs of the directories are not repeated per file.
+        std::vector<detail::AtomicFile*> changed;
+        for (const auto& file : written)
+        {
+            if (file)
+                changed.push_back(file.get());
+        }
+        detail::AtomicFile::commitAll(changed.data(), changed.size(), threadCount);
+        for (size_t i = 0; i < files.size(); ++i)
+        {
+            if (statuses[i] == UPDATE_CHANGED && !written[i]->committed())
+                statuses[i] = UPDATE_FAILED;
+        }
+
+        UpdateReport report;
+        for (auto status : statuses)
+        {
+            switch (status)
+            {
+                case UPDATE_CHANGED:    report.changed++; break;
+                case UPDATE_UNCHANGED:  report.unchanged++; break;
+                default:                report.failed++; break;
+            }
+        }
+
+        return report;
+    #endif // !EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+    }
+
+#ifdef EASY_TRANSLATE_PROFILE
+    /// @brief Get the json string of the usage profile, since the program start or the last #resetProfile().
+    /// @note - For each language: the number of lookups, hits and misses, the number of the unused
+    /// `Translation ID`s, and the hits of each `Translation ID` sorted by descending.
+    /// @note - Only available when define the macro \ref EASY_TRANSLATE_PROFILE.
+    std::string profileReport() const
+    {
+        Profile profile;
+        {
+            std::lock_guard<std::mutex> lock(profileMutex_);
+            profile = profile_;
+            mergeProfile(*snapshot_, profile);
+        }
+
+        nlohmann::json j = nlohmann::json::object();
+        for (const auto& language : profile)
+        {
+            std::vector<std::pair<std::string, uint64_t>> ids(language.second.hits.begin(),
+                                                              language.second.hits.end());
+            std::sort(ids.begin(), ids.end(),
+                      [](const std::pair<std::string, uint64_t>& a, const std::pair<std::string, uint64_t>& b)
+                      { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+
+            uint64_t hits = 0;
+            size_t unused = 0;
+            nlohmann::json list = nlohmann::json::array();
+            for (const auto& var : ids)
+            {
+                hits += var.second;
+                unused += var.second == 0 ? 1 : 0;
+                list.push_back({ { "id", var.first }, { "hits", var.second } });
+            }
+
+            j[language.first] = {
+                { "lookups", hits + language.second.misses },
+                { "hits", hits },
+                { "misses", language.second.misses },
+                { "unused", unused },
+                { "ids", std::move(list) }
+            };
+        }
+
+        return j.dump(4);
+    }
+
+    /// @brief Write the usage profile to a json file. (see the #profileReport())
+    /// @return If the failed to write the file return false else return true.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_PROFILE.
+    bool dumpProfile(const std::string& filename) const
+    { return detail::writeFileAtomically(filename, profileReport()); }
+
+    /// @brief Clear the usage profile.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_PROFILE.
+    void resetProfile()
+    {
+        std::lock_guard<std::mutex> lock(profileMutex_);
+        profile_.clear();
+        for (const Snapshot* layer = snapshot_.get(); layer; layer = layer->base.get())
+        {
+            for (size_t i = 0; i < layer->capacity(); ++i)
+                layer->hits[i].store(0, std::memory_order_relaxed);
+            layer->misses.store(0, std::memory_order_relaxed);
+        }
+    }
+#endif // EASY_TRANSLATE_PROFILE
+
+#ifdef EASY_TRANSLATE_MISSING_LOG
+    /// @brief Get the missing translations that are recorded since the last call.
+    /// @note - Each pair of the `Language ID` and `Translation ID` is recorded once until it is taken, a pair
+    /// that is still missing after it is taken is recorded again on its next miss.
+    /// @note - Only available when define the macro \ref EASY_TRANSLATE_MISSING_LOG.
+    std::vector<MissingTranslation> takeMissingTranslations()
+    {
+        std::vector<MissingTranslation> missing;
+        missingLog_.take([&](const char* languageId, const char* tranId) {
+            missing.push_back({ languageId, tranId });
+        });
+        return missing;
+    }
+
+    /// @brief Get the number of the lookup misses that are not recorded since the log is full of the records
+    /// that are not taken yet.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_MISSING_LOG.
+    uint64_t droppedMissingTranslations() const { return missingLog_.dropped(); }
+
+    /// @brief Append the missing translations that are recorded since the last take to a file,
+    /// one json object per line. (e.g. {"id":"App.Title","language":"en_US"})
+    /// @return The number of the appended missing translations.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_MISSING_LOG.
+    size_t dumpMissingTranslations(const std::string& filename)
+    {
+        std::vector<MissingTranslation> missing = takeMissingTranslations();
+        if (missing.empty())
+            return 0;
+
+        std::ofstream ofs(filename, std::ios::app);
+        if (!ofs.is_open())
+            return 0;
+        for (const auto& var : missing)
+        {
+            nlohmann::json j = { { "language", var.languageId }, { "id", var.tranId } };
+            ofs << j.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace) << '\n';
+        }
+        ofs.close();
+        return missing.size();
+    }
+
+    /// @brief Start a background thread that calls the #dumpMissingTranslations() periodically.
+    /// @note - If the dump is already started, restart it with the new arguments.
+    /// @note - Only available when define the macro \ref EASY_TRANSLATE_MISSING_LOG.
+    void startMissingTranslationsDump(const std::string& filename,
+                                      std::chrono::milliseconds interval = std::chrono::milliseconds(10000))
+    {
+        stopMissingTranslationsDump();
+
+        dumpStopped_ = false;
+        dumpThread_ = std::thread([this, filename, interval]() {
+            std::unique_lock<std::mutex> lock(dumpMutex_);
+            while (!dumpCv_.wait_for(lock, interval, [this]() { return dumpStopped_; }))
+                dumpMissingTranslations(filename);
+            dumpMissingTranslations(filename);
+        });
+    }
+
+    /// @brief Stop the background dump thread, the remaining missing translations are dumped before stop.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_MISSING_LOG.
+    void stopMissingTranslationsDump()
+    {
+        if (!dumpThread_.joinable())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(dumpMutex_);
+            dumpStopped_ = true;
+        }
+        dumpCv_.notify_all();
+        dumpThread_.join();
+    }
+#endif // EASY_TRANSLATE_MISSING_LOG
+
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+    /// @brief Start a background thread that watches the `Translations file`s of the current language (include
+    /// its fallback and base languages, and the namespace files of the split languages) and the `Languages file`,
+    /// and reloads the current language when they change.
+    /// @param debounce The burst of the changes (e.g. an editor saves by several writes) is reloaded once after
+    /// no more change in this time, but not later than 10 times of it after the first change.
+    /// @return If the inotify is not available return false else return true.
+    /// @note - The files are parsed on the watcher thread, then the new `Translations` are published atomically
+    /// like the #setCurrentLanguage(), so the reload never blocks the lookups. The reload listeners are called
+    /// after it, see the #addReloadListener().
+    /// @note - If a changed file is not a valid json (e.g. it is being written), it is not reloaded until
+    /// the next change.
+    /// @note - The `Languages file` is watched only if the `Languages` is set by the #setLanguages(filename).
+    /// The languages() may be replaced by the reload of it.
+    /// @note - If the hot reload is already started, restart it with the new arguments.
+    /// @note - Only available when define the macro \ref EASY_TRANSLATE_HOT_RELOAD.
+    /// @attention The `Translation text`s that got before are invalid after two reloads, like after the current
+    /// language is changed twice, get them again in the reload listener if they are kept.
+    bool startHotReload(std::chrono::milliseconds debounce = std::chrono::milliseconds(200))
+    {
+        stopHotReload();
+
+        std::unique_ptr<detail::FileWatcher> watcher(new detail::FileWatcher());
+        if (!watcher->isValid())
+            return false;
+
+        detail::FileWatcher* watching = watcher.get();
+        {
+            std::lock_guard<std::mutex> lock(languageMutex_);
+            watcher_ = std::move(watcher);
+        }
+        reloadStopped_ = false;
+        reloadThread_ = std::thread([this, watching, debounce]() { watchFiles(*watching, debounce); });
+        return true;
+    }
+
+    /// @brief Stop the hot reload, the pending changes are not reloaded.
+    /// @attention Do not call it in the reload listener.
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_HOT_RELOAD.
+    void stopHotReload()
+    {
+        if (!reloadThread_.joinable())
+            return;
+
+        reloadStopped_ = true;
+        watcher_->wake();
+        reloadThread_.join();
+
+        std::lock_guard<std::mutex> lock(languageMutex_);
+        watcher_.reset();
+    }
+
+    /// @brief Add a listener that is called with the `Language ID` after the current language is reloaded
+    /// by the hot reload.
+    /// @return The ID of the listener, see the #removeReloadListener().
+    /// @note - The listener is called on the watcher thread, e.g. post the QEvent::LanguageChange in it to
+    /// retranslate the Qt widgets.
+    /// @note - Only available when define the macro \ref EASY_TRANSLATE_HOT_RELOAD.
+    size_t addReloadListener(std::function<void(const std::string& languageId)> listener)
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        reloadListeners_.insert({ ++lastListenerId_, std::move(listener) });
+        return lastListenerId_;
+    }
+
+    /// @brief Remove the reload listener that is added by the #addReloadListener().
+    /// @note Only available when define the macro \ref EASY_TRANSLATE_HOT_RELOAD.
+    void removeReloadListener(size_t listenerId)
+    {
+        std::lock_guard<std::mutex> lock(listenerMutex_);
+        reloadListeners_.erase(listenerId);
+    }
+#endif // EASY_TRANSLATE_HOT_RELOAD
+
+private:
+    // A namespace file of the split `Translations`, it is loaded the first time it is used.
+    // (see the Languages::addManifest())
+    struct LazyNamespace
+    {
+        std::string name;
+        uint64_t hash;
+        std::string filename;
+        mutable std::once_flag once;
+        mutable std::unique_ptr<const Translations> translations;
+        mutable std::atomic<const Translations*> loaded;
+
+        LazyNamespace(const std::string& name, const std::string& filename)
+            : name(name), hash(detail::hash(name.c_str(), name.size())), filename(filename), loaded(nullptr)
+        {}
+
+        /// @brief Get the `Translations` of the namespace, it is loaded if not loaded yet.
+        const Translations& get() const
+        {
+            const Translations* trans = loaded.load(std::memory_order_acquire);
+            if (trans)
+                return *trans;
+
+            std::call_once(once, [this]() {
+                translations.reset(new Translations(Translations::fromFile(filename, name.empty() ? name : name + ".")));
+                loaded.store(translations.get(), std::memory_order_release);
+            });
+            return *translations;
+        }
+
+        bool isLoaded() const { return loaded.load(std::memory_order_acquire) != nullptr; }
+    };
+
+    // An embedded catalog that is looked up in place by its hash table, so the switch to it does not copy the
+    // catalog. The entry of a `Translation ID` (with its compiled message) is built on its first lookup.
+    // (see the EmbeddedCatalog::slots)
+    struct LazyCatalog
+    {
+        const EmbeddedCatalog& catalog;
+        // {Slot : Entry}, nullptr if it is not built yet.
+        std::unique_ptr<std::atomic<const detail::Entry*>[]> entries;
+        // The number of the `Translation ID`s.
+        size_t count;
+        mutable std::once_flag once;
+        mutable std::unique_ptr<const Translations> translations;
+
+        explicit LazyCatalog(const EmbeddedCatalog& catalog)
+            : catalog(catalog), entries(new std::atomic<const detail::Entry*>[catalog.slotCount]), count(0)
+        {
+            for (size_t i = 0; i < catalog.slotCount; ++i)
+            {
+                entries[i].store(nullptr, std::memory_order_relaxed);
+                count += catalog.slots[i] != 0 ? 1 : 0;
+            }
+        }
+
+        ~LazyCatalog()
+        {
+            for (size_t i = 0; i < catalog.slotCount; ++i)
+                delete entries[i].load(std::memory_order_relaxed);
+        }
+
+        /// @brief Get the entry of the slot at the given position, it is built if not built yet. nullptr if
+        /// the slot is empty.
+        const detail::Entry* entryAt(size_t slot) const
+        {
+            const detail::Entry* entry = entries[slot].load(std::memory_order_acquire);
+            if (entry || catalog.slots[slot] == 0)
+                return entry;
+
+            // The concurrent lookups may build it at the same time, the first one is kept.
+            std::unique_ptr<const detail::Entry> built(
+                new detail::Entry(detail::embeddedEntryAt(catalog, catalog.slots[slot] - 1)));
+            if (entries[slot].compare_exchange_strong(entry, built.get(), std::memory_order_acq_rel))
+                return built.release();
+            return entry;
+        }
+
+        /// @brief Get the whole `Translations` of the catalog, it is loaded if not loaded yet.
+        const Translations& get() const
+        {
+            std::call_once(once, [this]() { translations.reset(new Translations(Translations::fromEmbedded(catalog))); });
+            return *translations;
+        }
+    };
+
+#ifdef EASY_TRANSLATE_UTF16
+    // The UTF-16 `Translation ID`s of the missing `Translation ID`s, each one is transcoded once and kept until
+    // the `Snapshot` is freed. The lookups and the insertions are lock-free, the nodes are prepended to the
+    // bucket lists by CAS and never removed.
+    struct Missing16
+    {
+        static constexpr size_t BUCKETS = 64;
+
+        struct Node
+        {
+            uint64_t hash;
+            std::string tranId;
+            std::u16string text16;
+            const Node* next;
+        };
+
+        mutable std::atomic<const Node*> buckets[BUCKETS];
+
+        Missing16()
+        {
+            for (auto& bucket : buckets)
+                bucket.store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Missing16()
+        {
+            for (auto& bucket : buckets)
+            {
+                const Node* node = bucket.load(std::memory_order_relaxed);
+                while (node)
+                {
+                    const Node* next = node->next;
+                    delete node;
+                    node = next;
+                }
+            }
+        }
+
+        /// @brief Get the UTF-16 `Translation ID` of the given `Translation ID`, it is transcoded if not yet.
+        const std::u16string& get(const char* tranId, size_t len, uint64_t hash) const
+        {
+            std::atomic<const Node*>& bucket = buckets[hash & (BUCKETS - 1)];
+            const Node* head = bucket.load(std::memory_order_acquire);
+            if (const Node* node = findNode(head, nullptr, tranId, len, hash))
+                return node->text16;
+
+            std::unique_ptr<Node> built(new Node{ hash, std::string(tranId, len),
+                detail::utf8ToUtf16(tranId, len), head });
+            // Only the nodes prepended by the concurrent insertions since the last attempt are checked again.
+            while (!bucket.compare_exchange_weak(built->next, built.get(), std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+            {
+                if (const Node* node = findNode(built->next, head, tranId, len, hash))
+                    return node->text16;
+                head = built->next;
+            }
+            return built.release()->text16;
+        }
+
+    private:
+        static const Node* findNode(const Node* node, const Node* last, const char* tranId, size_t len,
+                                    uint64_t hash)
+        {
+            for (; node != last; node = node->next)
+            {
+                if (node->hash == hash && node->tranId.size() == len
+                    && std::memcmp(node->tranId.data(), tranId, len) == 0)
+                    return node;
+            }
+            return nullptr;
+        }
+    };
+#endif // EASY_TRANSLATE_UTF16
+
+    static constexpr size_t READER_STRIPES = 16;
+
+    // The number of the lookups in progress on each phase, the threads are spread on the stripes so they do
+    // not contend on a cache line. (see the #reclaim())
+    struct alignas(64) ReaderStripe
+    {
+        std::atomic<uint64_t> readers[2];
+    };
+
+    struct Snapshot;
+
+    // Pins the `Snapshot` of the current language during a lookup, the `Snapshot`s retired meanwhile are not
+    // freed until it ends. (see the #reclaim())
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const TranslateManager& manager)
+            : stripe_(manager.stripes_[detail::threadStripe() % READER_STRIPES])
+        {
+            // Enter on the phase that is still current after the counter is increased, so either the #reclaim()
+            // sees the counter or this sees the flipped phase and retries.
+            while (true)
+            {
+                phase_ = manager.phase_.load(std::memory_order_seq_cst);
+                stripe_.readers[phase_].fetch_add(1, std::memory_order_seq_cst);
+                if (manager.phase_.load(std::memory_order_seq_cst) == phase_)
+                    break;
+                stripe_.readers[phase_].fetch_sub(1, std::memory_order_release);
+            }
+            snapshot_ = manager.current_.load(std::memory_order_seq_cst);
+        }
+
+        ~ReadGuard() { stripe_.readers[phase_].fetch_sub(1, std::memory_order_release); }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const Snapshot& snapshot() const { return *snapshot_; }
+
+    private:
+        ReaderStripe& stripe_;
+        unsigned phase_;
+        const Snapshot* snapshot_;
+    };
+
+    // The published `Translations` of a language, it is immutable once published.
+    struct Snapshot
+    {
+        std::string languageId;
+        uint64_t languageHash;
+        std::shared_ptr<const Translations> translations;
+        // The `Translations` of the fallback languages in order, see the Languages::setFallback().
+        std::vector<std::shared_ptr<const Translations>> fallbacks;
+        // The index of the #translations and the entries of the #fallbacks that not overridden, it points into
+        // their storage. nullptr if there is not any fallback language.
+        std::unique_ptr<detail::HashIndex> flattened;
+        // The `Snapshot` of the base language that the `Translation ID`s not exist on this are looked up,
+        // it is shared by all languages based on it, see the Languages::setBase().
+        std::shared_ptr<const Snapshot> base;
+        // The namespace files of the split language sorted by the hash, they are looked up before the
+        // #index(). Empty if the language is not split, see the Languages::addManifest().
+        std::vector<std::unique_ptr<LazyNamespace>> namespaces;
+        // The embedded catalog that is looked up instead of the #index(), nullptr if the language is not
+        // embedded or has fallback languages. (see the Languages::addEmbedded())
+        std::unique_ptr<const LazyCatalog> embedded;
+        detail::PluralRule pluralRule;
+        // It is increased each time the `Snapshot` is replaced.
+        uint64_t generation;
+    #ifdef EASY_TRANSLATE_UTF16
+        // The missing `Translation ID`s that transcoded by the TranslateManager::translateU16().
+        Missing16 missing16;
+    #endif // EASY_TRANSLATE_UTF16
+    #ifdef EASY_TRANSLATE_PROFILE
+        // The hit counter of each slot (see the #capacity()), the lookups of the languages based on this are counted
+        // here too and reported as theirs.
+        std::unique_ptr<std::atomic<uint64_t>[]> hits;
+        mutable std::atomic<uint64_t> misses;
+    #endif // EASY_TRANSLATE_PROFILE
+
+        Snapshot(const std::string& languageId, std::shared_ptr<const Translations> translations,
+                 std::vector<std::shared_ptr<const Translations>> fallbacks, std::shared_ptr<const Snapshot> base,
+                 std::vector<std::unique_ptr<LazyNamespace>> namespaces, const EmbeddedCatalog* embedded,
+                 uint64_t generation)
+            : languageId(languageId), languageHash(detail::hash(languageId.c_str(), languageId.size())),
+            translations(std::move(translations)), fallbacks(std::move(fallbacks)), base(std::move(base)),
+            namespaces(std::move(namespaces)), embedded(embedded ? new LazyCatalog(*embedded) : nullptr),
+            pluralRule(detail::PluralRule::fromLanguageId(languageId)), generation(generation)
+        {
+            std::sort(this->namespaces.begin(), this->namespaces.end(),
+                      [](const std::unique_ptr<LazyNamespace>& a, const std::unique_ptr<LazyNamespace>& b)
+                      { return a->hash < b->hash; });
+
+            if (!this->fallbacks.empty())
+            {
+                size_t count = this->translations->count();
+                for (const auto& fallback : this->fallbacks)
+                    count += fallback->count();
+
+                flattened.reset(new detail::HashIndex());
+                flattened->reserve(count);
+                for (const auto& var : this->translations->translations_)
+                    flattened->insert(&var);
+                for (const auto& fallback : this->fallbacks)
+                {
+                    for (const auto& var : fallback->translations_)
+                    {
+                        std::string id = var.first.str();
+                        if (!flattened->find(var.first.hash(), id.data(), id.size()))
+                            flattened->insert(&var);
+                    }
+                }
+            }
+
+        #ifdef EASY_TRANSLATE_PROFILE
+            hits.reset(new std::atomic<uint64_t>[capacity()]);
+            for (size_t i = 0; i < capacity(); ++i)
+                hits[i].store(0, std::memory_order_relaxed);
+            misses.store(0, std::memory_order_relaxed);
+        #endif // EASY_TRANSLATE_PROFILE
+        }
+
+        /// @brief Get the index that the `Translation ID`s are looked up, if the language is not #embedded.
+        const detail::HashIndex& index() const { return flattened ? *flattened : translations->index_; }
+
+        /// @brief Get the `Translations` of this language, not include the fallback and base languages.
+        const Translations& whole() const { return embedded ? embedded->get() : *translations; }
+
+        /// @brief Get the number of the `Translation ID`s of the #whole().
+        size_t count() const { return embedded ? embedded->count : translations->count(); }
+
+        /// @brief Get the number of the slots of the #index() or the #embedded catalog.
+        size_t capacity() const { return embedded ? embedded->catalog.slotCount : index().capacity(); }
+
+        /// @brief Get the position of the slot of the given `Translation ID` in the #index() or the #embedded
+        /// catalog, if not exists return detail::HashIndex::npos.
+        size_t findSlot(uint64_t hash, const char* tranId, size_t len) const
+        {
+            return embedded ? detail::findEmbeddedSlot(embedded->catalog, hash, tranId, len)
+                            : index().findSlot(hash, tranId, len);
+        }
+
+        /// @brief Get the entry of the slot at the given position, nullptr if the slot is empty.
+        const detail::Entry* entryAt(size_t slot) const
+        {
+            if (embedded)
+                return embedded->entryAt(slot);
+            const detail::TranslationItem* item = index().itemAt(slot);
+            return item ? &item->second : nullptr;
+        }
+
+        /// @brief Prefetch the first slot that the given hash probes.
+        void prefetch(uint64_t hash) const
+        {
+            if (embedded)
+                EASY_TRANSLATE_PREFETCH(&embedded->catalog.slots[hash & (embedded->catalog.slotCount - 1)]);
+            else
+                index().prefetch(hash);
+        }
+
+    #ifdef EASY_TRANSLATE_PROFILE
+        /// @brief Get the `Translation ID` of the slot at the given position, if the slot is empty return false.
+        bool idAt(size_t slot, std::string& id) const
+        {
+            if (embedded)
+            {
+                uint32_t first = embedded->catalog.slots[slot];
+                if (first == 0)
+                    return false;
+                const EmbeddedEntry& entry = embedded->catalog.entries[first - 1];
+                id.assign(embedded->catalog.strings + entry.id, entry.idLength);
+                return true;
+            }
+            const detail::TranslationItem* item = index().itemAt(slot);
+            if (item)
+                id = item->first.str();
+            return item != nullptr;
+        }
+    #endif // EASY_TRANSLATE_PROFILE
+
+        /// @brief Get the namespace file of the split language that the `Translation ID` belongs to,
+        /// nullptr if the language is not split or the namespace file not exists. (the file is not loaded)
+        const LazyNamespace* splitNamespace(const char* tranId, size_t len) const
+        {
+            if (namespaces.empty())
+                return nullptr;
+
+            size_t spaceLen = detail::splitNamespaceLength(tranId, len);
+            const LazyNamespace* space = findNamespace(tranId, spaceLen);
+            return space || spaceLen == 0 ? space : findNamespace(tranId, 0);
+        }
+
+        /// @brief Get the entry of the given `Translation ID` and it hash on this `Snapshot`, not include the
+        /// base language. If not exists return nullptr.
+        const detail::Entry* findEntry(uint64_t hash, const char* tranId, size_t len) const
+        {
+            const LazyNamespace* space = splitNamespace(tranId, len);
+            const detail::TranslationItem* item = space ? space->get().index_.find(hash, tranId, len) : nullptr;
+            if (item)
+                return &item->second;
+            size_t slot = findSlot(hash, tranId, len);
+            return slot != detail::HashIndex::npos ? entryAt(slot) : nullptr;
+        }
+
+    private:
+        const LazyNamespace* findNamespace(const char* name, size_t len) const
+        {
+            uint64_t hash = detail::hash(name, len);
+            auto it = std::lower_bound(namespaces.begin(), namespaces.end(), hash,
+                                       [](const std::unique_ptr<LazyNamespace>& space, uint64_t value)
+                                       { return space->hash < value; });
+            for (; it != namespaces.end() && (*it)->hash == hash; ++it)
+            {
+                if ((*it)->name.size() == len && std::memcmp((*it)->name.data(), name, len) == 0)
+                    return it->get();
+            }
+            return nullptr;
+        }
+    };
+
+    TranslateManager()
+        : snapshot_(std::make_shared<const Snapshot>("", std::make_shared<const Translations>(),
+                                                   std::vector<std::shared_ptr<const Translations>>(), nullptr,
+                                                   std::vector<std::unique_ptr<LazyNamespace>>(), nullptr, 0)),
+        current_(snapshot_.get()), phase_(0)
+    {
+        published_ = std::make_shared<const Languages>();
+        currentLanguageId_.store(&*languageIds_.insert(std::string()).first, std::memory_order_relaxed);
+        for (auto& stripe : stripes_)
+        {
+            stripe.readers[0].store(0, std::memory_order_relaxed);
+            stripe.readers[1].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ~TranslateManager()
+    {
+    #ifdef EASY_TRANSLATE_HOT_RELOAD
+        stopHotReload();
+    #endif // EASY_TRANSLATE_HOT_RELOAD
+    #ifdef EASY_TRANSLATE_MISSING_LOG
+        stopMissingTranslationsDump();
+    #endif // EASY_TRANSLATE_MISSING_LOG
+    }
+
+    TranslateManager(const TranslateManager&) = delete;
+
+    TranslateManager& operator=(const TranslateManager&) = delete;
+
+    /// @brief Set the `Languages` and the `Languages file` that it is from (empty if not from a file).
+    void setLanguages(const Languages& languages, const std::string& filename)
+    {
+        std::lock_guard<std::mutex> lock(languageMutex_);
+        languages_ = languages;
+        publishLanguages();
+        loaded_.clear();
+    #ifdef EASY_TRANSLATE_HOT_RELOAD
+        languagesFile_ = filename;
+        if (watcher_)
+            watcher_->wake();
+    #else
+        (void) filename;
+    #endif // EASY_TRANSLATE_HOT_RELOAD
+    }
+
+    /// @brief Publish a copy of the #languages_ for the readers that do not hold the #languageMutex_.
+    /// @note The caller should hold the #languageMutex_.
+    void publishLanguages()
+    { std::atomic_store(&published_, std::shared_ptr<const Languages>(new Languages(languages_))); }
+
+    /// @brief Get the `Languages` that published last, see the #publishLanguages().
+    std::shared_ptr<const Languages> publishedLanguages() const { return std::atomic_load(&published_); }
+
+    /// @brief Load the given language and publish it as the current language, see the #setCurrentLanguage().
+    /// @note The caller should hold the #languageMutex_.
+    bool changeLanguage(const std::string& languageId)
+    {
+        if (!languages_.has(languageId))
+            return false;
+
+    #ifdef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+        bool isFirst = currentLanguage_.empty();
+    #endif // EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+        currentLanguage_ = languageId;
+        currentLanguageId_.store(&*languageIds_.insert(languageId).first, std::memory_order_release);
+
+        // The namespaces of the split languages that in use.
+        std::set<std::string> used;
+        for (const Snapshot* layer = snapshot_.get(); layer; layer = layer->base.get())
+        {
+            for (const auto& space : layer->namespaces)
+            {
+                if (space->isLoaded())
+                    used.insert(space->name);
+            }
+        }
+
+        std::vector<std::string> loading;
+        std::shared_ptr<const Snapshot> snapshot = load(languageId, snapshot_->generation + 1, loading);
+
+        // Load the namespace files that in use before the switch, in parallel.
+        std::vector<const LazyNamespace*> preload;
+        for (const Snapshot* layer = snapshot.get(); layer; layer = layer->base.get())
+        {
+            for (const auto& space : layer->namespaces)
+            {
+            #ifdef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+                // All `Translation ID`s of the first language are collected.
+                if (isFirst || used.find(space->name) != used.end())
+            #else
+                if (used.find(space->name) != used.end())
+            #endif // EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+                    preload.push_back(space.get());
+            }
+        }
+        detail::parallelFor(preload.size(), 0, [&](size_t i) { preload[i]->get(); });
+
+        publish(std::move(snapshot));
+
+    #ifdef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+        if (isFirst)
+        {
+            for (const Snapshot* snapshot = snapshot_.get(); snapshot; snapshot = snapshot->base.get())
+            {
+                for (const auto& space : snapshot->namespaces)
+                {
+                    for (const auto& var : space->get().translations_)
+                        tranIds_.insert(var.first.str());
+                }
+                for (const auto& var : snapshot->whole().translations_)
+                    tranIds_.insert(var.first.str());
+                for (const auto& fallback : snapshot->fallbacks)
+                {
+                    for (const auto& var : fallback->translations_)
+                        tranIds_.insert(var.first.str());
+                }
+            }
+        }
+    #endif // EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
 
-    /// @brief Check whether exists the given `Language ID`.
-    bool has(const std::string& languageId) const
-    { return languages_.find(languageId) != languages_.end(); }
+    #ifdef EASY_TRANSLATE_HOT_RELOAD
+        // The watched files are changed with the language.
+        if (watcher_)
+            watcher_->wake();
+    #endif // EASY_TRANSLATE_HOT_RELOAD
 
-    /// @brief Get all `Language ID`s.
-    std::vector<std::string> getIds() const
-    {
-        std::vector<std::string> ids;
-        for (const auto& var : languages_)
-            ids.push_back(var.first);
-        return ids;
+        return true;
     }
 
-    /// @brief Add a pair of the `Language ID` and `Translations filename`.
-    /// @note If the given `Language ID` already exists, do nothing.
-    void add(const std::string& languageId, const std::string& translationsFilename)
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+    /// @brief Get the files that the current language is loaded from, and the `Languages file`.
+    std::set<std::string> watchedFiles() const
     {
-        if (!has(languageId))
-            languages_.insert({ languageId, translationsFilename });
+        std::lock_guard<std::mutex> lock(languageMutex_);
+
+        std::set<std::string> files;
+        if (!languagesFile_.empty())
+            files.insert(languagesFile_);
+        for (const Snapshot* layer = snapshot_.get(); layer; layer = layer->base.get())
+        {
+            for (const auto& languageId : languages_.fallbackChain(layer->languageId))
+            {
+                if (languages_.isEmbedded(languageId) || languages_.source(languageId))
+                    continue;
+                const std::string& filename = languages_.at(languageId);
+                files.insert(filename);
+                if (!languages_.isManifest(languageId))
+                    continue;
+                for (const auto& var : detail::readManifest(filename))
+                    files.insert(var.second);
+            }
+        }
+        return files;
     }
 
-    /// @brief Remove a `Language ID` and it corresponding `Translations filename`.
-    void remove(const std::string& languageId)
+    /// @brief Watch the files and reload the current language when they change, until the hot reload stopped.
+    /// (see the #startHotReload())
+    void watchFiles(detail::FileWatcher& watcher, std::chrono::milliseconds debounce)
     {
-        if (has(languageId))
-            languages_.erase(languageId);
+        typedef std::chrono::steady_clock Clock;
+
+        std::set<std::string> changed;
+        Clock::time_point first;
+        Clock::time_point deadline;
+        watcher.watch(watchedFiles());
+        while (!reloadStopped_)
+        {
+            int timeout = -1;
+            if (!changed.empty())
+            {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+                timeout = left > 0 ? static_cast<int>(left) + 1 : 0;
+            }
+
+            bool pending = !changed.empty();
+            detail::FileWatcher::WaitResult result = watcher.wait(timeout, changed);
+            if (result == detail::FileWatcher::WAIT_WOKEN)
+            {
+                watcher.watch(watchedFiles());
+                continue;
+            }
+
+            Clock::time_point now = Clock::now();
+            if (result == detail::FileWatcher::WAIT_CHANGED)
+            {
+                if (!pending)
+                    first = now;
+                deadline = std::min(now + debounce, first + debounce * 10);
+            }
+            else if (pending && now >= deadline)
+            {
+                reload(changed);
+                changed.clear();
+            }
+        }
     }
 
-    /// @brief Remove all `Language ID`s and it corresponding `Translations filename`s.
-    void clear() { languages_.clear(); }
+    /// @brief Reload the current language after the given files changed, and call the reload listeners.
+    /// @return If a changed file is not a valid json or the current language is not exist return false,
+    /// the current language is kept.
+    bool reload(const std::set<std::string>& changed)
+    {
+        for (const auto& filename : changed)
+        {
+            if (!detail::isJsonFile(filename))
+                return false;
+        }
 
-private:
-    // {Language ID : Translations filename}
-    std::map<std::string, std::string> languages_;
-};
+        std::string languageId;
+        {
+            std::lock_guard<std::mutex> lock(languageMutex_);
+            if (changed.find(languagesFile_) != changed.end())
+            {
+                languages_ = Languages::fromFile(languagesFile_);
+                publishLanguages();
+            }
+            // The base languages may be changed also.
+            loaded_.clear();
+            if (!changeLanguage(currentLanguage_))
+                return false;
+            languageId = currentLanguage_;
+        }
 
-class Translations
-{
-    friend class TranslateManager;
-public:
-    Translations() = default;
+        std::vector<std::function<void(const std::string&)>> listeners;
+        {
+            std::lock_guard<std::mutex> lock(listenerMutex_);
+            for (const auto& var : reloadListeners_)
+                listeners.push_back(var.second);
+        }
+        for (const auto& listener : listeners)
+            listener(languageId);
+        return true;
+    }
+#endif // EASY_TRANSLATE_HOT_RELOAD
 
-    Translations(const std::vector<std::pair<std::string, std::string>>& trans)
+    /// @brief Replace the `Snapshot` of the current language.
+    /// @note The replaced `Snapshot` is kept alive until the next replacement, so the `Translation text`s that
+    /// got from it are valid until the current language is changed twice. Then it is retired, and freed once
+    /// the lookups that may still use it are ended. (see the ReadGuard)
+    /// @attention Call it with the #languageMutex_ locked.
+    void publish(std::shared_ptr<const Snapshot> snapshot)
     {
-        for (const auto& var : trans)
-            translations_.insert({ var.first, var.second });
+    #ifdef EASY_TRANSLATE_PROFILE
+        std::lock_guard<std::mutex> lock(profileMutex_);
+        mergeProfile(*snapshot_, profile_, true);
+    #endif // EASY_TRANSLATE_PROFILE
+        if (retired_)
+            pending_.push_back(std::move(retired_));
+        retired_ = std::move(snapshot_);
+        snapshot_ = std::move(snapshot);
+        current_.store(snapshot_.get(), std::memory_order_seq_cst);
+        reclaim();
     }
 
-    Translations(const std::map<std::string, std::string>& trans) : translations_(trans) {}
+    /// @brief Get the number of the lookups in progress that entered on the given phase.
+    uint64_t readers(unsigned phase) const
+    {
+        uint64_t count = 0;
+        for (const auto& stripe : stripes_)
+            count += stripe.readers[phase].load(std::memory_order_seq_cst);
+        return count;
+    }
 
-    /// @brief Load the `Translations` from a json string.
-    /// @note If the json is invalid, the `Translations` will be empty.
-    static Translations fromJson(const std::string& json)
+    /// @brief Free the retired `Snapshot`s that no lookup uses, it is a grace period of the two phases: the
+    /// #pending_ `Snapshot`s are moved to the #draining_ by flipping the #phase_, the new lookups enter on the
+    /// new phase and never see them, so they are freed once the lookups on the old phase are ended.
+    /// @note It never waits, the `Snapshot`s that still in use are freed by a later call.
+    void reclaim()
     {
-        using Json = nlohmann::json;
+        unsigned phase = phase_.load(std::memory_order_relaxed);
+        if (!draining_.empty())
+        {
+            if (readers(phase ^ 1) != 0)
+                return;
+            draining_.clear();
+        }
+        if (pending_.empty())
+            return;
 
-        Json j = Json::parse(json, nullptr, false, true);
-        if (j.is_discarded())
-            return Translations();
+        phase_.store(phase ^ 1, std::memory_order_seq_cst);
+        draining_.swap(pending_);
+        if (readers(phase) == 0)
+            draining_.clear();
+    }
 
-        std::map<std::string, std::string> list;
-        for (const auto& var : j.items())
-            list.insert({ var.key(), var.value() });
+    /// @brief Load the whole `Translations` of the given language, from its source, file, manifest or embedded
+    /// catalog.
+    Translations loadTranslations(const std::string& languageId) const
+    {
+        auto source = languages_.source(languageId);
+        if (source)
+            return source->load();
 
-        return Translations(list);
+        const char* filename = languages_.at(languageId);
+        if (languages_.isManifest(languageId))
+            return Translations::fromManifest(filename);
+        if (languages_.isEmbedded(languageId))
+        {
+            const EmbeddedCatalog* catalog = findEmbeddedCatalog(filename);
+            return catalog ? Translations::fromEmbedded(*catalog) : Translations();
+        }
+        return Translations::fromFile(filename);
     }
 
-    /// @brief Load the `Translations` from a json file.
-    /// @note If the json is invalid, the `Translations` will be empty.
-    static Translations fromFile(const std::string& filename)
+    /// @brief Load the `Snapshot` of the given language with its fallback languages and base language.
+    /// @param loading The `Language ID`s that are loading, to break the cycle of the base languages.
+    std::shared_ptr<const Snapshot> load(const std::string& languageId, uint64_t generation,
+                                         std::vector<std::string>& loading)
     {
-        using Json = nlohmann::json;
+        loading.push_back(languageId);
 
-        std::ifstream ifs(filename);
-        if (!ifs.is_open())
-            return Translations();
+        std::vector<std::string> chain = languages_.fallbackChain(languageId);
 
-        Json j = Json::parse(ifs, nullptr, false, true);
-        if (j.is_discarded())
+        // The split language loads its namespace files on demand, and the embedded catalog is looked up in place,
+        // but their fallback languages are loaded fully.
+        std::vector<std::unique_ptr<LazyNamespace>> namespaces;
+        const EmbeddedCatalog* embedded = nullptr;
+        std::shared_ptr<const Translations> translations;
+        if (languages_.isManifest(languageId))
         {
-            ifs.close();
-            return Translations();
+            for (const auto& var : detail::readManifest(languages_.at(languageId)))
+                namespaces.emplace_back(new LazyNamespace(var.first, var.second));
+            translations = std::make_shared<const Translations>();
+        }
+        else if (languages_.isEmbedded(languageId) && chain.size() == 1 &&
+                 (embedded = findEmbeddedCatalog(languages_.at(languageId))) != nullptr && embedded->slots)
+        {
+            translations = std::make_shared<const Translations>();
+        }
+        else
+        {
+            embedded = nullptr;
+            translations = std::make_shared<const Translations>(loadTranslations(languageId));
         }
 
-        std::map<std::string, std::string> list;
-        ifs.close();
-        for (const auto& var : j.items())
-            list.insert({ var.key(), var.value() });
+        std::vector<std::shared_ptr<const Translations>> fallbacks;
+        for (size_t i = 1; i < chain.size(); ++i)
+            fallbacks.push_back(std::make_shared<const Translations>(loadTranslations(chain[i])));
 
-        return Translations(list);
-    }
+        std::shared_ptr<const Snapshot> base;
+        std::string baseId = languages_.base(languageId);
+        if (languages_.has(baseId) && std::find(loading.begin(), loading.end(), baseId) == loading.end())
+        {
+            auto it = loaded_.find(baseId);
+            if (it != loaded_.end())
+                base = it->second.lock();
+            if (!base)
+                base = load(baseId, 0, loading);
+        }
 
-    /// @brief Get the json string.
-    std::string toJson() const
-    {
-        nlohmann::json j;
-        for (const auto& var : translations_)
-            j[var.first] = var.second;
-        return j.dump(4);
-    }
+        std::shared_ptr<const Snapshot> snapshot = std::make_shared<const Snapshot>(
+            languageId, std::move(translations), std::move(fallbacks), std::move(base), std::move(namespaces),
+            embedded, generation);
 
-    /// @brief Write the `Translations` to a json file.
-    /// @return If the failed to write the file return false else return true.
-    bool toFile(const std::string& filename) const
-    {
-        std::ofstream ofs(filename);
-        if (!ofs.is_open())
-            return false;
-        ofs << toJson();
-        ofs.close();
-        return true;
+        for (auto it = loaded_.begin(); it != loaded_.end();)
+            it = it->second.expired() ? loaded_.erase(it) : std::next(it);
+        loaded_[languageId] = snapshot;
+        return snapshot;
     }
 
-    /// @brief Get the `Translation text` of the given `Translation ID`.
-    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
-    const char* at(const std::string& tranId) const
+#ifdef EASY_TRANSLATE_PROFILE
+    struct LanguageProfile
     {
-        if (!has(tranId))
-            return tranId.c_str();
-        return translations_.at(tranId).c_str();
-    }
+        // {Translation ID : Hits}
+        std::map<std::string, uint64_t> hits;
+        uint64_t misses = 0;
+    };
 
-    /// @brief Get the number of the `Translation ID`.
-    size_t count() const { return translations_.size(); }
+    // {Language ID : LanguageProfile}
+    typedef std::map<std::string, LanguageProfile> Profile;
 
-    /// @brief Check whether has not any `Translation ID`.
-    bool empty() const { return count() == 0; }
+    /// @brief Add the counters of the `Snapshot` and its base languages to the `profile`.
+    /// @param take Whether to reset the merged counters, the counters of a base language are shared with the
+    /// next language based on it.
+    static void mergeProfile(const Snapshot& snapshot, Profile& profile, bool take = false)
+    {
+        if (snapshot.languageId.empty())
+            return;
 
-    /// @brief Check whether exists the given `Translation ID`.
-    bool has(const std::string& tranId) const
-    { return translations_.find(tranId) != translations_.end(); }
+        auto read = [take](std::atomic<uint64_t>& counter) {
+            return take ? counter.exchange(0, std::memory_order_relaxed) : counter.load(std::memory_order_relaxed);
+        };
 
-    /// @brief Get all `Translation ID`s
-    std::vector<std::string> getIds() const
-    {
-        std::vector<std::string> ids;
-        for (const auto& var : translations_)
-            ids.push_back(var.first);
-        return ids;
+        LanguageProfile& language = profile[snapshot.languageId];
+        std::string tranId;
+        for (const Snapshot* layer = &snapshot; layer; layer = layer->base.get())
+        {
+            for (size_t i = 0; i < layer->capacity(); ++i)
+            {
+                if (layer->idAt(i, tranId))
+                    language.hits[tranId] += read(layer->hits[i]);
+            }
+            language.misses += read(layer->misses);
+        }
     }
+#endif // EASY_TRANSLATE_PROFILE
 
-    /// @brief Add a pair of the `Translation ID` and `Translation text`.
-    /// @note If the given `Translation ID` already exists, do nothing.
-    void add(const std::string& tranId, const std::string& translation)
+    /// @brief Get the entry of the given `Translation ID` on the given `Snapshot`, if not exists return nullptr.
+    const detail::Entry* lookup(const Snapshot& snapshot, const char* tranId, size_t len) const
     {
-        if (!has(tranId))
-            translations_.insert({ tranId, translation });
+        return find(snapshot, tranId, len, detail::hash(tranId, len));
     }
 
-    /// @brief Remove a `Translation ID` and it corresponding `Translation text`.
-    void remove(const std::string& tranId)
+    /// @brief Get the entry of the given `Translation ID` on the given `Snapshot`, it is the plural form of the
+    /// count if the `Translation text` has plural forms. If not exists return nullptr.
+    const detail::Entry* lookupPlural(const Snapshot& snapshot, const char* tranId, size_t len, long long n) const
     {
-        if (has(tranId))
-            translations_.erase(tranId);
+        const detail::Entry* entry = find(snapshot, tranId, len, detail::hash(tranId, len));
+        if (!entry || !entry->plural)
+            return entry;
+        unsigned long long count = n < 0 ? 0 - static_cast<unsigned long long>(n) : static_cast<unsigned long long>(n);
+        return &entry->plural->forms[snapshot.pluralRule.select(count)];
     }
 
-    /// @brief Remove all `Translation ID`s and it corresponding `Translation text`s.
-    void clear() { translations_.clear(); }
-
-private:
-    // {Translation ID : Translation text}
-    std::map<std::string, std::string> translations_;
-};
+    /// @brief Record the `Translation ID` that is looked up for the #updateTranslationsFiles(), it does nothing
+    /// when undefine the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES.
+    void recordId(const char* tranId) const
+    {
+    #ifdef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+        tranIds_.insert(tranId);
+    #else
+        (void) tranId;
+    #endif // EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+    }
 
-// Singleton class
-class TranslateManager
-{
-public:
-    static TranslateManager& getInstance()
+    /// @brief Get the `Translation text` of the given `Translation ID` on the given `Snapshot`.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    const char* translate(const Snapshot& snapshot, const char* tranId, size_t len) const
     {
-        static TranslateManager instance;
-        return instance;
+        const detail::Entry* entry = find(snapshot, tranId, len, detail::hash(tranId, len));
+        return entry ? entry->text.c_str() : tranId;
     }
 
-    /// @brief Get the `Translation text` of the given `Translation ID` on current language.
-    /// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
-#ifndef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-    const char* translate(const std::string& tranId) const
+    /// @brief Get the `Translation text` of the given `Translation ID` on the given `Snapshot` with its length.
+    /// @note If the given `Translation ID` is not exist, return the `Translation ID` itself.
+    TextView translateView(const Snapshot& snapshot, const char* tranId, size_t len) const
     {
-        return translations_.at(tranId);
+        const detail::Entry* entry = find(snapshot, tranId, len, detail::hash(tranId, len));
+        return entry ? TextView{ entry->text.c_str(), entry->text.size() } : TextView{ tranId, len };
     }
-#else
-    /// @brief Get the `Translation text` of the given `Translation ID` on current language.
-    /// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
-    const char* translate(const std::string& tranId)
+
+#ifdef EASY_TRANSLATE_UTF16
+    /// @brief Get the UTF-16 `Translation text` of the given `Translation ID` on the given `Snapshot`.
+    /// @note If the given `Translation ID` is not exist, return the UTF-16 `Translation ID`, it is transcoded
+    /// once per language and looked up without locking later.
+    std::u16string_view translateU16(const Snapshot& snapshot, const char* tranId, size_t len) const
     {
-        tranIds_.insert(tranId);
-        return translations_.at(tranId);
+        uint64_t hash = detail::hash(tranId, len);
+        const detail::Entry* entry = find(snapshot, tranId, len, hash);
+        if (entry)
+            return entry->text16;
+        return snapshot.missing16.get(tranId, len, hash);
     }
-#endif // EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+#endif // EASY_TRANSLATE_UTF16
 
-    /// @brief Set the `Languages`.
-    void setLanguages(const Languages& languages) { languages_ = languages; }
+    /// @brief Get the entry of the given `Translation ID` and it hash on the given `Snapshot`,
+    /// if not exists return nullptr.
+    const detail::Entry* find(const Snapshot& snapshot, const char* tranId, size_t len, uint64_t hash) const
+    {
+        // The delta language is looked up on its small index first, then on its base language.
+        const detail::Entry* entry = nullptr;
+        for (const Snapshot* layer = &snapshot; layer && !entry; layer = layer->base.get())
+        {
+            // The lookups of the split language are not counted per `Translation ID` by the profile.
+            const LazyNamespace* space = layer->splitNamespace(tranId, len);
+            const detail::TranslationItem* item = space ? space->get().index_.find(hash, tranId, len) : nullptr;
+            if (item)
+            {
+                entry = &item->second;
+                break;
+            }
 
-    /// @brief Set the `Languages` that from a json file.
-    void setLanguages(const std::string& filename) { languages_ = Languages::fromFile(filename); }
+            size_t slot = layer->findSlot(hash, tranId, len);
+        #ifdef EASY_TRANSLATE_PROFILE
+            if (slot == detail::HashIndex::npos && layer->base)
+                continue;
+            // The concurrent lookups of the same `Translation ID` are all counted, the #mergeProfile() takes the
+            // counts by exchange so none is lost between two reports either.
+            std::atomic<uint64_t>& counter = slot != detail::HashIndex::npos ? layer->hits[slot] : layer->misses;
+            counter.fetch_add(1, std::memory_order_relaxed);
+        #endif // EASY_TRANSLATE_PROFILE
+            entry = slot != detail::HashIndex::npos ? layer->entryAt(slot) : nullptr;
+        }
 
-    /// @brief Get the `Language ID` of the current language.
-    const char* currentLanguage() const { return currentLanguage_.c_str(); }
+    #ifdef EASY_TRANSLATE_MISSING_LOG
+        if (!entry && !snapshot.languageId.empty())
+        {
+            uint64_t key = (hash ^ (snapshot.languageHash * 0x9E3779B97F4A7C15ULL)) | 1;
+            missingLog_.record(key, snapshot.languageId, tranId, len);
+        }
+    #endif // EASY_TRANSLATE_MISSING_LOG
 
-    /// @brief Set the current language by `Language ID`.
-    /// @return If success to change return true else return false.
-    bool setCurrentLanguage(const std::string& languageId)
+        return entry;
+    }
+
+    /// @brief Format the `Translation text` of the entry with the arguments, or the `Translation ID` itself
+    /// if the entry is nullptr. (see the #formatTo())
+    /// @param rule The plural rule of the language of the entry.
+    static size_t formatTo(const detail::PluralRule& rule, const detail::Entry* entry, const char* tranId, size_t len,
+                           const detail::FormatArg* args, size_t count, char* buffer, size_t capacity)
     {
-        if (!hasLanguage(languageId))
-            return false;
+        detail::FormatWriter writer(buffer, capacity > 0 ? capacity - 1 : 0);
+        if (!entry)
+            detail::formatMessage(tranId, len, args, count, rule, writer);
+        else if (!entry->message)
+            writer.write(entry->text.data(), entry->text.size());
+        else
+            entry->message->format(entry->text.c_str(), args, count, rule, writer);
 
-    #ifdef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-        bool isFirst = currentLanguage_.empty();
-    #endif // !EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-        currentLanguage_ = languageId;
-        translations_ = Translations::fromFile(languages_.at(languageId));
+        if (capacity > 0)
+            buffer[writer.size() < capacity - 1 ? writer.size() : capacity - 1] = '\0';
+        return writer.size();
+    }
 
-    #ifdef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-        if (isFirst)
+    /// @brief Format the `Translation text` of the entry with the arguments to a FormattedText, see the #formatTo().
+    static FormattedText formatArgs(const detail::PluralRule& rule, const detail::Entry* entry, const char* tranId,
+                                    size_t len, const detail::FormatArg* args, size_t count)
+    {
+        FormattedText text;
+        text.size_ = formatTo(rule, entry, tranId, len, args, count, text.inline_, FormattedText::inlineCapacity);
+        if (text.size_ >= FormattedText::inlineCapacity)
         {
-            for (const auto& var : translations_.translations_)
-                tranIds_.insert(var.first);
+            text.heap_.reset(new char[text.size_ + 1]);
+            formatTo(rule, entry, tranId, len, args, count, text.heap_.get(), text.size_ + 1);
         }
-    #endif // !EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-
-        return true;
+        return text;
     }
 
-    const Languages& languages() const { return languages_; }
-
-    const Translations& translations() const { return translations_; }
+    /// @brief Resolve the `Translation ID`s on the given `Snapshot`.
+    /// @note All hashes of a chunk are computed and their slots prefetched before any of them is probed,
+    /// so the cache misses of the probes overlap.
+    void translate(const Snapshot& snapshot, const char* const* tranIds, size_t count, const char** texts) const
+    {
+        const size_t chunkSize = 32;
+        size_t lens[chunkSize];
+        uint64_t hashes[chunkSize];
 
-    /// @brief Get the number of the `Language ID`.
-    size_t languageCount() const { return languages_.count(); }
+        for (size_t begin = 0; begin < count; begin += chunkSize)
+        {
+            size_t end = count - begin < chunkSize ? count : begin + chunkSize;
 
-    /// @brief Get the number of the `Translation ID` on current language.
-    size_t translationCount() const { return translations_.count(); }
+            for (size_t i = begin; i < end; ++i)
+            {
+                lens[i - begin] = std::strlen(tranIds[i]);
+                hashes[i - begin] = detail::hash(tranIds[i], lens[i - begin]);
+                for (const Snapshot* layer = &snapshot; layer; layer = layer->base.get())
+                    layer->prefetch(hashes[i - begin]);
+            }
 
-    /// @brief Check whether exists the given `Language ID`.
-    bool hasLanguage(const std::string& languageId) const { return languages_.has(languageId); }
+            for (size_t i = begin; i < end; ++i)
+            {
+                const detail::Entry* entry = find(snapshot, tranIds[i], lens[i - begin], hashes[i - begin]);
+                texts[i] = entry ? entry->text.c_str() : tranIds[i];
+            }
+        }
+    }
 
-    /// @brief Check whether exists the given `Translation ID`.
-    bool hasTranslation(const std::string& tranId) const { return translations_.has(tranId); }
+#ifdef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+    enum UpdateStatus
+    {
+        UPDATE_CHANGED,
+        UPDATE_UNCHANGED,
+        UPDATE_FAILED
+    };
 
-    /// @brief Update all `Translations file`s. (add pairs of the new `Translation ID` and empty `Translation text`)
-    /// @return The number of updated files.
-    /// @note - The new `Translation ID` is from all `Translation ID` that passed as #translate() function argument in programs.
-    /// @note - This function can help you to easy get the all `Translation ID` that need to translate.
-    /// @attention - Make sure to call this function after you already call all #translate() function,
-    /// if not you will get incomplete `Translation ID` list.
-    /// @attention - This function is not effect when undefine the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES.
-    size_t updateTranslationsFiles() const
+    /// @brief Update a `Translations file`, see the #updateTranslationsFiles().
+    /// @param written The temporary file that has the updated content if the file is changed, it replaces the
+    /// file on the detail::AtomicFile::commitAll().
+    static UpdateStatus updateTranslationsFile(const std::string& filename, const std::set<std::string>& tranIds,
+                                               std::unique_ptr<detail::AtomicFile>& written)
     {
-    #ifndef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-        return 0;
-    #else
         using Json = nlohmann::json;
 
-        size_t updated = 0;
-        for (const auto& languageId : languages_.getIds())
+        try
         {
-            std::string filename = languages_.at(languageId);
-            std::ifstream ifs(filename);
-            Json j;
-            if (!ifs.is_open())
+            std::string content;
+            std::ifstream ifs(filename, std::ios::binary);
+            bool exists = ifs.is_open();
+            if (exists)
+            {
+                content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+                ifs.close();
+            }
+
+            Json j = exists ? Json::parse(content, nullptr, false, true) : Json();
+            if (!exists || j.is_discarded())
             {
-                for (const auto& tranId : tranIds_)
+                j = Json();
+                for (const auto& tranId : tranIds)
                     j[tranId] = "";
             }
             else
             {
-                j = Json::parse(ifs, nullptr, false, true);
-                if (j.is_discarded())
-                {
-                    j = Json();
-                    for (const auto& tranId : tranIds_)
-                        j[tranId] = "";
-                }
-                else
-                {
-                    std::map<std::string, std::string> map; // For sort
-                    for (const auto& tranId : tranIds_)
-                        j.contains(tranId) ? map.insert({ tranId, j[tranId] }) : map.insert({ tranId, "" });
+                // The nested file is kept nested, see the Translations::fromJson().
+                std::map<std::string, Json> existing;
+                auto collect = [&](const std::string& tranId, const Json& value) { existing.insert({ tranId, value }); };
+                detail::forEachJsonEntry(j, std::string(), collect);
 
-                    j.clear();
-                    for (const auto& var : map)
-                        j[var.first] = var.second;
+                std::map<std::string, Json> map; // For sort
+                for (const auto& tranId : tranIds)
+                {
+                    auto it = existing.find(tranId);
+                    it != existing.end() ? map.insert({ tranId, it->second }) : map.insert({ tranId, Json("") });
                 }
-
-                ifs.close();
+                j = detail::entriesToJson(map, detail::isNestedJson(j));
             }
 
-            std::ofstream ofs(filename);
-            if (!ofs.is_open())
-                continue;
+            // The invalid UTF-8 in the collected `Translation ID`s is replaced like the Translations::toFile().
+            std::string updated = j.dump(4, ' ', false, Json::error_handler_t::replace);
+            if (exists && updated == content)
+                return UPDATE_UNCHANGED;
 
-            ofs << j.dump(4);
-            ofs.close();
-            updated++;
+            written.reset(new detail::AtomicFile(filename));
+            return written->write(updated) ? UPDATE_CHANGED : UPDATE_FAILED;
+        }
+        catch (const std::exception&)
+        {
+            return UPDATE_FAILED;
         }
-
-        return updated;
-    #endif // EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
     }
+#endif // EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
 
-private:
-    TranslateManager() = default;
-
-    ~TranslateManager() = default;
-
-    TranslateManager(const TranslateManager&) = delete;
-
-    TranslateManager& operator=(const TranslateManager&) = delete;
-
-#ifdef EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
-    std::set<std::string> tranIds_;
-#endif // !EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+#ifdef EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
+    // The `Translation ID`s that recorded by the #recordId().
+    mutable std::set<std::string> tranIds_;
+#endif // EASY_TRANSLATE_COLLECT_TRANSLATION_IDS
     std::string currentLanguage_;
+    // All `Language ID`s that have been the current language, they are never removed so the #currentLanguageId_
+    // is always valid.
+    std::set<std::string> languageIds_;
+    // The #currentLanguage_ that is read without the #languageMutex_, it points into the #languageIds_.
+    std::atomic<const std::string*> currentLanguageId_;
     Languages languages_;
-    Translations translations_;
+    // The immutable copy of the #languages_ that is read without the #languageMutex_, it is replaced as a whole.
+    std::shared_ptr<const Languages> published_;
+    // Serializes the changes of the `Languages` and the current language, the lookups never take it.
+    mutable std::mutex languageMutex_;
+    std::shared_ptr<const Snapshot> snapshot_;
+    // The `Snapshot` replaced by the #snapshot_, its `Translation text`s are still valid.
+    std::shared_ptr<const Snapshot> retired_;
+    // The `Snapshot`s replaced by the #retired_, they wait for the next flip of the #phase_.
+    std::vector<std::shared_ptr<const Snapshot>> pending_;
+    // The `Snapshot`s that wait for the lookups on the old phase to end, see the #reclaim().
+    std::vector<std::shared_ptr<const Snapshot>> draining_;
+    std::atomic<const Snapshot*> current_;
+    // The phase that the new lookups enter on, 0 or 1.
+    std::atomic<unsigned> phase_;
+    mutable ReaderStripe stripes_[READER_STRIPES];
+    // {Language ID : Snapshot}, the loaded `Snapshot`s that are still alive, so the base languages are shared.
+    std::map<std::string, std::weak_ptr<const Snapshot>> loaded_;
+#ifdef EASY_TRANSLATE_PROFILE
+    // The counters of the replaced `Snapshot`s.
+    Profile profile_;
+    mutable std::mutex profileMutex_;
+#endif // EASY_TRANSLATE_PROFILE
+#ifdef EASY_TRANSLATE_MISSING_LOG
+    mutable detail::MissingLog missingLog_;
+    std::thread dumpThread_;
+    std::mutex dumpMutex_;
+    std::condition_variable dumpCv_;
+    bool dumpStopped_ = true;
+#endif // EASY_TRANSLATE_MISSING_LOG
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+    // The `Languages file` that the #languages_ is from, empty if it is not from a file.
+    std::string languagesFile_;
+    std::unique_ptr<detail::FileWatcher> watcher_;
+    std::thread reloadThread_;
+    std::atomic<bool> reloadStopped_{ true };
+    // {Listener ID : Listener}
+    std::map<size_t, std::function<void(const std::string&)>> reloadListeners_;
+    size_t lastListenerId_ = 0;
+    std::mutex listenerMutex_;
+#endif // EASY_TRANSLATE_HOT_RELOAD
 };
 
 // For convenience
@@ -481,6 +5666,67 @@ inline TranslateManager& getTranslateManager()
 inline const char* translate(const std::string& tranId)
 { return getTranslateManager().translate(tranId); }
 
+/// @brief Get the `Translation text` of the given `Translation ID` on current language.
+/// @note If the given `Translation ID` is not exist on the current language, return the `Translation ID` itself.
+inline const char* translate(const char* tranId)
+{ return getTranslateManager().translate(tranId); }
+
+/// @brief Get the `Translation text`s of the given `Translation ID`s on current language.
+/// @note All `Translation ID`s are resolved on the same language. See TranslateManager::translate().
+inline void translate(const char* const* tranIds, size_t count, const char** texts)
+{ getTranslateManager().translate(tranIds, count, texts); }
+
+/// @brief Get the `Translation text`s of the given `Translation ID`s on current language.
+/// @note All `Translation ID`s are resolved on the same language. See TranslateManager::translate().
+template <size_t N>
+inline void translate(const char* const (&tranIds)[N], const char* (&texts)[N])
+{ getTranslateManager().translate(tranIds, N, texts); }
+
+/// @brief Get the `Translation text` of the given `Translation ID` on current language, and replace its
+/// placeholders with the arguments. See TranslateManager::format().
+template <typename... Args>
+inline FormattedText format(const char* tranId, const Args&... args)
+{ return getTranslateManager().format(tranId, args...); }
+
+/// @brief Format the `Translation text` of the given `Translation ID` on current language to the buffer.
+/// See TranslateManager::formatTo().
+template <typename... Args>
+inline size_t formatTo(char* buffer, size_t capacity, const char* tranId, const Args&... args)
+{ return getTranslateManager().formatTo(buffer, capacity, tranId, args...); }
+
+/// @brief Get the `Translation text` of the given `Translation ID` on current language with its length.
+/// See TranslateManager::translateView().
+inline TextView translateView(const char* tranId)
+{ return getTranslateManager().translateView(tranId); }
+
+/// @brief Get the `Translation text` of the given `Translation ID` on current language with its length.
+/// See TranslateManager::translateView().
+inline TextView translateView(const std::string& tranId)
+{ return getTranslateManager().translateView(tranId); }
+
+#ifdef EASY_TRANSLATE_UTF16
+/// @brief Get the UTF-16 `Translation text` of the given `Translation ID` on current language.
+/// See TranslateManager::translateU16().
+inline std::u16string_view translateU16(const char* tranId)
+{ return getTranslateManager().translateU16(tranId); }
+
+/// @brief Get the UTF-16 `Translation text` of the given `Translation ID` on current language.
+/// See TranslateManager::translateU16().
+inline std::u16string_view translateU16(const std::string& tranId)
+{ return getTranslateManager().translateU16(tranId); }
+#endif // EASY_TRANSLATE_UTF16
+
+/// @brief Get the plural form of the `Translation text` of the given `Translation ID` on current language,
+/// that is chosen by the count `n`. See TranslateManager::translatePlural().
+inline const char* translatePlural(const char* tranId, long long n)
+{ return getTranslateManager().translatePlural(tranId, n); }
+
+/// @brief Format the plural form of the `Translation text` of the given `Translation ID` on current language,
+/// that is chosen by the count `n`. See TranslateManager::formatPlural().
+template <typename... Args>
+inline FormattedText formatPlural(const char* tranId, long long n, const Args&... args)
+{ return getTranslateManager().formatPlural(tranId, n, args...); }
+
 /// @brief Set the `Languages`.
 inline void setLanguages(const Languages& langs)
 { getTranslateManager().setLanguages(langs); }
@@ -513,22 +5759,91 @@ inline bool hasLanguage(const std::string& languageId)
 inline bool hasTranslation(const std::string& tranId)
 { return getTranslateManager().hasTranslation(tranId); }
 
-inline const Languages& languages()
+inline Languages languages()
 { return getTranslateManager().languages(); }
 
 inline const Translations& translations()
 { return getTranslateManager().translations(); }
 
 /// @brief Update all `Translations file`s. (add pairs of the new `Translation ID` and empty `Translation text`)
-/// @return The number of updated files.
-/// @note - The new `Translation ID` is from all `Translation ID` that passed as #tr() function argument in programs.
+/// @return The number of updated files. (the files that are unchanged are counted as updated)
+/// @note - The new `Translation ID` is from all `Translation ID` that passed as #tr() function argument in programs,
+/// or from all `Translation ID` that registered by the EASYTR() when define the macro \ref EASY_TRANSLATE_ID_REGISTRY.
 /// @note - This function can help you to easy get the all `Translation ID` that need to translate.
+/// @note - The files are updated on the calling thread, use the #updateTranslationsFiles(size_t) to update
+/// them in parallel.
 /// @attention - Make sure to call this function after you already call all #tr() function,
-/// if not you will get incomplete `Translation ID` list.
-/// @attention - This function is not effect when undefine the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES.
+/// if not you will get incomplete `Translation ID` list. (not required by the \ref EASY_TRANSLATE_ID_REGISTRY)
+/// @attention - This function is not effect when undefine both the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+/// and \ref EASY_TRANSLATE_ID_REGISTRY.
 inline size_t updateTranslationsFiles()
 { return getTranslateManager().updateTranslationsFiles(); }
 
+/// @brief Update all `Translations file`s in parallel. (see the #updateTranslationsFiles())
+/// @param threadCount The number of the worker threads, 0 means the number of the hardware threads.
+/// @return The number of changed, unchanged and failed files.
+/// @note The file whose updated content is same as the content on disk is not rewritten.
+/// @attention - This function is not effect when undefine both the macro \ref EASY_TRANSLATE_UPDATE_TRANSLATIONS_FILES
+/// and \ref EASY_TRANSLATE_ID_REGISTRY.
+inline UpdateReport updateTranslationsFiles(size_t threadCount)
+{ return getTranslateManager().updateTranslationsFiles(threadCount); }
+
+#ifdef EASY_TRANSLATE_PROFILE
+/// @brief Get the json string of the usage profile, see the TranslateManager::profileReport().
+inline std::string profileReport()
+{ return getTranslateManager().profileReport(); }
+
+/// @brief Write the usage profile to a json file, see the TranslateManager::profileReport().
+inline bool dumpProfile(const std::string& filename)
+{ return getTranslateManager().dumpProfile(filename); }
+
+/// @brief Clear the usage profile.
+inline void resetProfile()
+{ getTranslateManager().resetProfile(); }
+#endif // EASY_TRANSLATE_PROFILE
+
+#ifdef EASY_TRANSLATE_MISSING_LOG
+/// @brief Get the missing translations that are recorded since the last call.
+/// See the TranslateManager::takeMissingTranslations().
+inline std::vector<MissingTranslation> takeMissingTranslations()
+{ return getTranslateManager().takeMissingTranslations(); }
+
+/// @brief Append the missing translations that are recorded since the last take to a file.
+/// See the TranslateManager::dumpMissingTranslations().
+inline size_t dumpMissingTranslations(const std::string& filename)
+{ return getTranslateManager().dumpMissingTranslations(filename); }
+
+/// @brief Start a background thread that dumps the missing translations to a file periodically.
+/// See the TranslateManager::startMissingTranslationsDump().
+inline void startMissingTranslationsDump(const std::string& filename,
+                                         std::chrono::milliseconds interval = std::chrono::milliseconds(10000))
+{ getTranslateManager().startMissingTranslationsDump(filename, interval); }
+
+/// @brief Stop the background thread that dumps the missing translations.
+inline void stopMissingTranslationsDump()
+{ getTranslateManager().stopMissingTranslationsDump(); }
+#endif // EASY_TRANSLATE_MISSING_LOG
+
+#ifdef EASY_TRANSLATE_HOT_RELOAD
+/// @brief Start watching the files of the current language and reload it when they change.
+/// See the TranslateManager::startHotReload().
+inline bool startHotReload(std::chrono::milliseconds debounce = std::chrono::milliseconds(200))
+{ return getTranslateManager().startHotReload(debounce); }
+
+/// @brief Stop the hot reload.
+inline void stopHotReload()
+{ getTranslateManager().stopHotReload(); }
+
+/// @brief Add a listener that is called after the current language is reloaded by the hot reload.
+/// See the TranslateManager::addReloadListener().
+inline size_t addReloadListener(std::function<void(const std::string& languageId)> listener)
+{ return getTranslateManager().addReloadListener(std::move(listener)); }
+
+/// @brief Remove the reload listener.
+inline void removeReloadListener(size_t listenerId)
+{ getTranslateManager().removeReloadListener(listenerId); }
+#endif // EASY_TRANSLATE_HOT_RELOAD
+
 } // namespace easytr
 
 #endif // !EASY_TRANSLATE_HPP
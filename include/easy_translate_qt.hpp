@@ -0,0 +1,197 @@
+// The Qt integration of the "easy translate" library, in c++.
+//
+// Webs: https://github.com/JaderoChan/easy_translate
+// You can contact me by email: c_dl_cn@outlook.com
+
+// MIT License
+//
+// Copyright (c) 2024 頔珞JaderoChan
+
+#ifndef EASY_TRANSLATE_QT_HPP
+#define EASY_TRANSLATE_QT_HPP
+
+#include <atomic>           // atomic
+#include <cstddef>          // size_t
+#include <cstdint>          // uint64_t, uintptr_t
+#include <cstring>          // strlen
+#include <memory>           // shared_ptr, unique_ptr, atomic_load
+#include <string>           // string
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QString>
+#include <QTranslator>
+
+#include "easy_translate.hpp"
+
+// Usage:
+//   easytr::setLanguages("./language/language.json");
+//   easytr::QtTranslator translator;
+//   QCoreApplication::installTranslator(&translator);
+//   easytr::QtTranslator::setCurrentLanguage("Zh");
+//
+// Then the tr("Translation ID") and QCoreApplication::translate(context, "Translation ID") get the
+// `Translation text` on current language, and the widgets retranslate themselves on the QEvent::LanguageChange.
+
+namespace easytr
+{
+
+// A QTranslator that serves the tr() and QCoreApplication::translate() from the current language of the easytr.
+//   - The source text is the `Translation ID`, the context and disambiguation are ignored.
+//   - With the count `n` (n >= 0), the plural form is chosen by the easytr::translatePlural(), and the Qt
+//     replaces the `%n` in it.
+//   - Each `Translation text` is converted to the QString once per language, the later calls return the
+//     cached implicitly shared QString without allocating or transcoding. The lookups never lock, the cache
+//     of each language is replaced as a whole when the language is changed.
+//   - If the source text is not a `Translation ID` of the current language, the Qt uses the source text.
+class QtTranslator : public QTranslator
+{
+public:
+    explicit QtTranslator(QObject* parent = nullptr) : QTranslator(parent) {}
+
+    QString translate(const char* context, const char* sourceText,
+                      const char* disambiguation = nullptr, int n = -1) const override
+    {
+        (void) context;
+        (void) disambiguation;
+        if (!sourceText)
+            return QString();
+
+        TranslateManager& manager = getTranslateManager();
+        manager.recordId(sourceText);
+        // The `Translation text` is converted before the `Snapshot` is unpinned, so it is valid meanwhile even if
+        // the current language is changed.
+        TranslateManager::ReadGuard guard(manager);
+        const TranslateManager::Snapshot& snapshot = guard.snapshot();
+        size_t len = std::strlen(sourceText);
+
+        TextView text;
+        if (n >= 0)
+        {
+            const detail::Entry* entry = manager.lookupPlural(snapshot, sourceText, len, n);
+            if (!entry)
+                return QString();
+            text = TextView{ entry->text.c_str(), entry->text.size() };
+        }
+        else
+        {
+            text = manager.translateView(snapshot, sourceText, len);
+            if (text.data == sourceText)
+                return QString();
+        }
+
+        std::shared_ptr<const Cache> cache = std::atomic_load(&cache_);
+        if (!cache || cache->generation != snapshot.generation)
+        {
+            std::shared_ptr<const Cache> fresh = std::make_shared<const Cache>(snapshot.generation, snapshot.count());
+            // The concurrent calls may replace it at the same time, the first one is kept. If the kept one is
+            // of another generation, the `fresh` is used but not kept.
+            if (std::atomic_compare_exchange_strong(&cache_, &cache, fresh) ||
+                cache->generation != snapshot.generation)
+                cache = fresh;
+        }
+        return cache->get(text);
+    }
+
+    bool isEmpty() const override { return false; }
+
+    /// @brief Set the current language of the easytr, and send the QEvent::LanguageChange to the application
+    /// so the widgets retranslate themselves.
+    /// @return If the given `Language ID` is not exist return false else return true.
+    static bool setCurrentLanguage(const std::string& languageId)
+    {
+        if (!easytr::setCurrentLanguage(languageId))
+            return false;
+
+        if (QCoreApplication::instance())
+        {
+            QEvent event(QEvent::LanguageChange);
+            QCoreApplication::sendEvent(QCoreApplication::instance(), &event);
+        }
+        return true;
+    }
+
+private:
+    // {Translation text : QString} of a generation of the `Translations`, keyed by the address of the
+    // `Translation text`. The nodes are prepended to the bucket lists by CAS and never changed or removed, so
+    // the lookups and the insertions are lock-free.
+    struct Cache
+    {
+        struct Node
+        {
+            const char* text;
+            QString string;
+            const Node* next;
+        };
+
+        // See the TranslateManager::generation().
+        uint64_t generation;
+        size_t mask;
+        std::unique_ptr<std::atomic<const Node*>[]> buckets;
+
+        Cache(uint64_t generation, size_t count) : generation(generation)
+        {
+            size_t capacity = 64;
+            while (capacity < count && capacity < (size_t(1) << 20))
+                capacity *= 2;
+            mask = capacity - 1;
+            buckets.reset(new std::atomic<const Node*>[capacity]);
+            for (size_t i = 0; i < capacity; ++i)
+                buckets[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Cache()
+        {
+            for (size_t i = 0; i <= mask; ++i)
+            {
+                const Node* node = buckets[i].load(std::memory_order_relaxed);
+                while (node)
+                {
+                    const Node* next = node->next;
+                    delete node;
+                    node = next;
+                }
+            }
+        }
+
+        /// @brief Get the QString of the given `Translation text`, it is converted if not yet.
+        QString get(TextView text) const
+        {
+            // The `Translation text`s are at least 8 bytes apart, the low bits are all the same.
+            std::atomic<const Node*>& bucket = buckets[(reinterpret_cast<uintptr_t>(text.data) >> 3) & mask];
+            const Node* head = bucket.load(std::memory_order_acquire);
+            if (const Node* node = findNode(head, nullptr, text.data))
+                return node->string;
+
+            std::unique_ptr<Node> built(
+                new Node{ text.data, QString::fromUtf8(text.data, static_cast<int>(text.size)), head });
+            // Only the nodes prepended by the concurrent insertions since the last attempt are checked again.
+            while (!bucket.compare_exchange_weak(built->next, built.get(), std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+            {
+                if (const Node* node = findNode(built->next, head, text.data))
+                    return node->string;
+                head = built->next;
+            }
+            return built.release()->string;
+        }
+
+        static const Node* findNode(const Node* node, const Node* last, const char* text)
+        {
+            for (; node != last; node = node->next)
+            {
+                if (node->text == text)
+                    return node;
+            }
+            return nullptr;
+        }
+    };
+
+    // The cache of the current generation, it is replaced as a whole by the first lookup after the language is
+    // changed. The lookups that still use the replaced one keep it alive.
+    mutable std::shared_ptr<const Cache> cache_;
+};
+
+} // namespace easytr
+
+#endif // !EASY_TRANSLATE_QT_HPP
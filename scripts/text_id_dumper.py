@@ -2,8 +2,9 @@ import json
 import os
 import re
 
-suffixs = {".h", ".hpp", ".c", "cpp", ".cxx", ".cc"}
+suffixs = {".h", ".hpp", ".c", ".cpp", ".cxx", ".cc"}
 flag = "EASYTR"
+pattern = re.compile(r"\b" + flag + r"(?:\(|_\w+\()\s*\"((?:[^\"\\]|\\.)*)\"\s*[,)]")
 
 dir_path = input("Enter the directory path: ")
 files = []
@@ -22,9 +23,7 @@ for file in files:
     print(f"Processing file: {file}, {i+1}/{len(files)}")
     with open(file, "r", encoding="utf-8", errors="ignore") as f:
         for line in f:
-            result = re.search(f"{flag}(\"(.*)\")", line)
-            if result:
-                textId = result.group(1)
+            for textId in pattern.findall(line):
                 text_ids.update({textId: ""})
     i += 1
 
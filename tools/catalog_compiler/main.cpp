@@ -0,0 +1,181 @@
+// Compile a `Translations file` into a C++ source of the easytr::EmbeddedCatalog, that is used by the CMake
+// function easy_translate_embed_catalog(). Or pack the `Translations file`s into an easytr::Bundle, that is used
+// by the CMake function easy_translate_pack_bundle().
+//
+// Usage: catalog_compiler <Translations file> <output source file> <catalog name>
+//        catalog_compiler -b <output bundle file> <catalog name>=<Translations file>...
+//
+// The source has the constant tables of the `Translation ID`s and `Translation text`s, ordered and hashed like
+// the easytr::Translations, and the hash table of them, and registers the catalog by its name on the static
+// initialization. The bundle has the same tables of each catalog, except the hash table.
+
+#include <cstdio>       // printf, fprintf
+#include <fstream>      // ifstream, ofstream
+#include <map>          // map
+#include <iterator>     // istreambuf_iterator
+#include <sstream>      // ostringstream
+#include <string>       // string
+#include <vector>       // vector
+
+#include <easy_translate.hpp>
+
+/// @brief Get the character of the C literal, the non-printable characters are escaped in octal.
+/// @param quotation The quotation mark of the literal that should be escaped.
+static std::string escape(unsigned char c, char quotation)
+{
+    // The '?' is escaped for the trigraphs.
+    if (c == quotation || c == '\\' || c == '?')
+        return std::string(1, '\\') + static_cast<char>(c);
+    if (c >= 0x20 && c < 0x7F)
+        return std::string(1, static_cast<char>(c));
+
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), "\\%03o", c);
+    return buffer;
+}
+
+/// @brief Get the C string literal of the given string.
+static std::string quote(const std::string& str)
+{
+    std::string out = "\"";
+    for (unsigned char c : str)
+        out += escape(c, '"');
+    return out + "\"";
+}
+
+/// @brief Get the C identifier of the given name, the other characters are replaced with the '_'.
+static std::string identifier(const std::string& name)
+{
+    std::string out = name;
+    for (char& c : out)
+    {
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+        c = valid ? c : '_';
+    }
+    return out;
+}
+
+static std::string generate(const easytr::Translations& translations, const std::string& name,
+                            const std::string& input)
+{
+    easytr::detail::CatalogTables catalog = easytr::detail::buildCatalog(translations);
+
+    std::ostringstream oss;
+    oss << "// Generated by the catalog_compiler from the " << input << ", do not edit.\n\n"
+        << "#include <easy_translate.hpp>\n\n"
+        << "namespace\n{\n\n";
+
+    // The array of the characters instead of a string literal, that has a length limit on some compilers.
+    oss << "const char strings[] = {";
+    for (size_t i = 0; i < catalog.strings.size(); ++i)
+        oss << (i % 16 == 0 ? "\n    " : " ") << "'" << escape(catalog.strings[i], '\'') << "',";
+    oss << (catalog.strings.empty() ? " 0 };\n\n" : "\n};\n\n");
+
+    oss << "const easytr::EmbeddedEntry entries[] = {";
+    for (const auto& entry : catalog.entries)
+    {
+        oss << "\n    { " << entry.hash << "ULL, " << entry.id << ", " << entry.idLength << ", " << entry.spaceLength
+            << ", " << entry.text << ", " << entry.textLength << ", " << static_cast<int>(entry.form) << " },";
+    }
+    oss << (catalog.entries.empty() ? " { 0, 0, 0, 0, 0, 0, 0 } };\n\n" : "\n};\n\n");
+
+    // The hash table is loaded as is, so the `Translation ID`s are looked up without building an index.
+    oss << "const uint32_t slots[] = {";
+    for (size_t i = 0; i < catalog.slots.size(); ++i)
+        oss << (i % 16 == 0 ? "\n    " : " ") << catalog.slots[i] << ",";
+    oss << "\n};\n\n";
+
+    oss << "} // namespace\n\n"
+        << "// Declare it to register the catalog explicitly, e.g. if the source is linked from a static library.\n"
+        << "extern const easytr::EmbeddedCatalog easytr_catalog_" << identifier(name) << ";\n"
+        << "const easytr::EmbeddedCatalog easytr_catalog_" << identifier(name) << " = { " << quote(name)
+        << ", strings, entries, " << catalog.entries.size() << ", slots, " << catalog.slots.size() << " };\n\n"
+        << "static const easytr::EmbeddedCatalogRegistrar registrar(easytr_catalog_" << identifier(name) << ");\n";
+    return oss.str();
+}
+
+/// @brief Read and parse a `Translations file`.
+/// @return If failed to read the file or it is not a valid json return false else return true.
+static bool read(const std::string& filename, easytr::Translations& translations)
+{
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        std::fprintf(stderr, "Failed to read the file: %s\n", filename.c_str());
+        return false;
+    }
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+
+    // The invalid file fails the build, instead of an empty catalog.
+    if (!nlohmann::json::accept(content, true))
+    {
+        std::fprintf(stderr, "The file is not a valid json: %s\n", filename.c_str());
+        return false;
+    }
+
+    translations = easytr::Translations::fromJson(content);
+    return true;
+}
+
+/// @brief Pack the catalogs of the arguments `<catalog name>=<Translations file>` into a bundle file.
+static int pack(const std::string& output, int argc, char* argv[])
+{
+    std::map<std::string, easytr::Translations> catalogs;
+    for (int i = 0; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        size_t pos = arg.find('=');
+        if (pos == 0 || pos == std::string::npos)
+        {
+            std::fprintf(stderr, "Invalid catalog, expected <catalog name>=<Translations file>: %s\n", argv[i]);
+            return 1;
+        }
+        if (!read(arg.substr(pos + 1), catalogs[arg.substr(0, pos)]))
+            return 1;
+    }
+
+    if (!easytr::Bundle::write(output, catalogs))
+    {
+        std::fprintf(stderr, "Failed to write the file: %s\n", output.c_str());
+        return 1;
+    }
+
+    for (const auto& var : catalogs)
+        std::printf("%s: %zu Translation IDs.\n", var.first.c_str(), var.second.count());
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc >= 3 && std::string(argv[1]) == "-b")
+        return pack(argv[2], argc - 3, argv + 3);
+
+    if (argc != 4)
+    {
+        std::printf("Usage: catalog_compiler <Translations file> <output source file> <catalog name>\n"
+                    "       catalog_compiler -b <output bundle file> <catalog name>=<Translations file>...\n");
+        return 1;
+    }
+
+    easytr::Translations translations;
+    if (!read(argv[1], translations))
+        return 1;
+
+    std::ofstream ofs(argv[2], std::ios::binary);
+    if (!ofs.is_open())
+    {
+        std::fprintf(stderr, "Failed to write the file: %s\n", argv[2]);
+        return 1;
+    }
+    ofs << generate(translations, argv[3], argv[1]);
+    ofs.close();
+    if (!ofs)
+    {
+        std::fprintf(stderr, "Failed to write the file: %s\n", argv[2]);
+        return 1;
+    }
+
+    std::printf("%s: %zu Translation IDs.\n", argv[3], translations.count());
+    return 0;
+}
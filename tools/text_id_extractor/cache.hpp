@@ -0,0 +1,115 @@
+// The persistent cache of the `Translation ID`s found in each source file, so only the changed files
+// are scanned again.
+
+#ifndef EASY_TRANSLATE_TEXT_ID_EXTRACTOR_CACHE_HPP
+#define EASY_TRANSLATE_TEXT_ID_EXTRACTOR_CACHE_HPP
+
+#include <cstdint>      // uint64_t, int64_t
+#include <cstdio>       // snprintf
+#include <exception>    // exception
+#include <fstream>      // ifstream, ofstream
+#include <map>          // map
+#include <string>       // string
+#include <vector>       // vector
+
+#include <nlohmann/json.hpp>
+
+namespace extractor
+{
+
+struct FileRecord
+{
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    // The easytr::detail::hash() of the file content.
+    uint64_t hash = 0;
+    std::vector<std::string> ids;
+};
+
+// {Source filename : FileRecord}
+class Cache
+{
+public:
+    static constexpr int kVersion = 1;
+
+    /// @brief Load the cache from a json file.
+    /// @note If the file is not exists, invalid or made with the other `marker`, the cache will be empty.
+    static Cache fromFile(const std::string& filename, const std::string& marker)
+    {
+        using Json = nlohmann::json;
+
+        Cache cache;
+        std::ifstream ifs(filename);
+        if (!ifs.is_open())
+            return cache;
+
+        Json j = Json::parse(ifs, nullptr, false);
+        if (j.is_discarded() || !j.is_object() || j.value("version", 0) != kVersion ||
+            j.value("marker", "") != marker || !j.contains("files"))
+            return cache;
+
+        try
+        {
+            for (const auto& var : j["files"].items())
+            {
+                const Json& value = var.value();
+                FileRecord record;
+                record.size = value.at("size").get<uint64_t>();
+                record.mtime = value.at("mtime").get<int64_t>();
+                record.hash = std::stoull(value.at("hash").get<std::string>(), nullptr, 16);
+                record.ids = value.at("ids").get<std::vector<std::string>>();
+                cache.records_.insert({ var.key(), std::move(record) });
+            }
+        }
+        catch (const std::exception&)
+        {
+            cache.records_.clear();
+        }
+
+        return cache;
+    }
+
+    /// @brief Write the cache to a json file.
+    /// @return If the failed to write the file return false else return true.
+    bool toFile(const std::string& filename, const std::string& marker) const
+    {
+        nlohmann::json files = nlohmann::json::object();
+        for (const auto& var : records_)
+        {
+            char hash[17];
+            std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(var.second.hash));
+            files[var.first] = {
+                { "size", var.second.size },
+                { "mtime", var.second.mtime },
+                { "hash", hash },
+                { "ids", var.second.ids }
+            };
+        }
+
+        nlohmann::json j = { { "version", kVersion }, { "marker", marker }, { "files", std::move(files) } };
+        std::ofstream ofs(filename, std::ios::binary);
+        if (!ofs.is_open())
+            return false;
+        ofs << j.dump();
+        ofs.close();
+        return static_cast<bool>(ofs);
+    }
+
+    /// @brief Get the record of the given file, if not exists return nullptr.
+    const FileRecord* find(const std::string& filename) const
+    {
+        auto it = records_.find(filename);
+        return it != records_.end() ? &it->second : nullptr;
+    }
+
+    void set(const std::string& filename, FileRecord record) { records_[filename] = std::move(record); }
+
+    const std::map<std::string, FileRecord>& records() const { return records_; }
+
+private:
+    std::map<std::string, FileRecord> records_;
+};
+
+} // namespace extractor
+
+#endif // !EASY_TRANSLATE_TEXT_ID_EXTRACTOR_CACHE_HPP
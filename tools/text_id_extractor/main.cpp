@@ -0,0 +1,345 @@
+// A native and multithreaded replacement of the scripts/text_id_dumper.py.
+//
+// Usage: text_id_extractor [options] <directory or file>...
+//   -l <file>     The `Languages file`, merge the found `Translation ID`s into its `Translations file`s.
+//   -o <file>     Write the found `Translation ID`s (with empty `Translation text`) to the json file.
+//   -j <count>    The number of the worker threads. (default: the number of the hardware threads)
+//   -m <marker>   The name of the translate macro. (default: EASYTR)
+//   -c <file>     The cache file, only the source files that changed since the last run are scanned.
+
+#include <algorithm>    // min, sort, unique
+#include <atomic>       // atomic
+#include <chrono>       // seconds
+#include <cstdio>       // printf, fprintf
+#include <cstdlib>      // strtoul
+#include <filesystem>   // recursive_directory_iterator
+#include <fstream>      // ifstream
+#include <map>          // map
+#include <set>          // set
+#include <string>       // string
+#include <thread>       // thread
+#include <vector>       // vector
+
+#include <easy_translate.hpp>
+
+#include "cache.hpp"
+#include "scanner.hpp"
+
+namespace fs = std::filesystem;
+
+static const std::set<std::string> kSuffixes = { ".h", ".hh", ".hpp", ".hxx", ".c", ".cc", ".cpp", ".cxx" };
+
+struct Options
+{
+    std::vector<std::string> paths;
+    std::string languagesFilename;
+    std::string outputFilename;
+    std::string cacheFilename;
+    std::string marker = "EASYTR";
+    size_t threadCount = 0;
+};
+
+static void printUsage()
+{
+    std::printf(
+        "Usage: text_id_extractor [options] <directory or file>...\n"
+        "  -l <file>     The Languages file, merge the found Translation IDs into its Translations files.\n"
+        "  -o <file>     Write the found Translation IDs (with empty Translation text) to the json file.\n"
+        "  -j <count>    The number of the worker threads. (default: the number of the hardware threads)\n"
+        "  -m <marker>   The name of the translate macro. (default: EASYTR)\n"
+        "  -c <file>     The cache file, only the source files that changed since the last run are scanned.\n");
+}
+
+static bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.size() == 2 && arg[0] == '-')
+        {
+            if (i + 1 >= argc)
+                return false;
+            const char* value = argv[++i];
+            switch (arg[1])
+            {
+                case 'l': options.languagesFilename = value; break;
+                case 'o': options.outputFilename = value; break;
+                case 'j': options.threadCount = std::strtoul(value, nullptr, 10); break;
+                case 'm': options.marker = value; break;
+                case 'c': options.cacheFilename = value; break;
+                default: return false;
+            }
+        }
+        else
+        {
+            options.paths.push_back(arg);
+        }
+    }
+
+    return !options.paths.empty() && !options.marker.empty() &&
+           (!options.languagesFilename.empty() || !options.outputFilename.empty());
+}
+
+static std::vector<std::string> findSourceFiles(const std::vector<std::string>& paths)
+{
+    std::vector<std::string> files;
+    for (const auto& path : paths)
+    {
+        std::error_code ec;
+        if (fs::is_regular_file(path, ec))
+        {
+            files.push_back(path);
+            continue;
+        }
+
+        for (fs::recursive_directory_iterator it(path, ec), end; !ec && it != end; it.increment(ec))
+        {
+            if (it->is_regular_file(ec) && kSuffixes.count(it->path().extension().string()) != 0)
+                files.push_back(it->path().string());
+        }
+    }
+    return files;
+}
+
+enum FileStatus
+{
+    FILE_CACHED,    // The size and mtime are not changed, use the cached `Translation ID`s.
+    FILE_UNCHANGED, // The content hash is not changed, use the cached `Translation ID`s.
+    FILE_SCANNED,   // The file is new or changed, scan it.
+    FILE_FAILED
+};
+
+/// @brief Get the record of the source file, scan it only if it is changed since the `cache` is made.
+static FileStatus extractFile(const std::string& filename, const Options& options, const extractor::Cache& cache,
+                              extractor::FileRecord& record)
+{
+    std::error_code ec;
+    auto mtime = fs::last_write_time(filename, ec);
+    uint64_t size = fs::file_size(filename, ec);
+    record.mtime = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+    // The file modified in the same mtime tick after the scan would not be detected, so the recently
+    // modified file is always checked by its content hash.
+    if (mtime > fs::file_time_type::clock::now() - std::chrono::seconds(2))
+        record.mtime = 0;
+
+    const extractor::FileRecord* cached = cache.find(filename);
+    if (!ec && cached && cached->mtime != 0 && cached->mtime == record.mtime && cached->size == size)
+    {
+        record = *cached;
+        return FILE_CACHED;
+    }
+
+    extractor::FileView file(filename);
+    if (!file.good())
+    {
+        std::fprintf(stderr, "Failed to read the file: %s\n", filename.c_str());
+        return FILE_FAILED;
+    }
+
+    record.size = file.size();
+    record.hash = easytr::detail::hash(file.data(), file.size());
+    if (cached && cached->size == record.size && cached->hash == record.hash)
+    {
+        record.ids = cached->ids;
+        return FILE_UNCHANGED;
+    }
+
+    extractor::scan(file.data(), file.size(), options.marker, record.ids);
+    std::sort(record.ids.begin(), record.ids.end());
+    record.ids.erase(std::unique(record.ids.begin(), record.ids.end()), record.ids.end());
+    return FILE_SCANNED;
+}
+
+/// @brief Get the `Translation ID`s of all source files, as the merge of the per-file `Translation ID`s.
+/// @param cache The records of the last run, it is replaced by the records of this run.
+/// @return Whether the `cache` is changed.
+static bool extractIds(const std::vector<std::string>& files, const Options& options, extractor::Cache& cache,
+                       std::set<std::string>& ids)
+{
+    size_t threadCount = options.threadCount != 0 ? options.threadCount : std::thread::hardware_concurrency();
+    threadCount = std::max<size_t>(1, std::min(threadCount, files.size()));
+
+    std::vector<extractor::FileRecord> records(files.size());
+    std::vector<FileStatus> statuses(files.size(), FILE_FAILED);
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        for (size_t i = next++; i < files.size(); i = next++)
+            statuses[i] = extractFile(files[i], options, cache, records[i]);
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadCount; ++i)
+        workers.emplace_back(work);
+    work();
+    for (auto& worker : workers)
+        worker.join();
+
+    size_t counts[FILE_FAILED + 1] = {};
+    extractor::Cache updated;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        counts[statuses[i]]++;
+        if (statuses[i] == FILE_FAILED)
+            continue;
+        ids.insert(records[i].ids.begin(), records[i].ids.end());
+        updated.set(files[i], std::move(records[i]));
+    }
+
+    std::printf("Files: %zu scanned, %zu unchanged, %zu cached, %zu failed.\n",
+                counts[FILE_SCANNED], counts[FILE_UNCHANGED], counts[FILE_CACHED], counts[FILE_FAILED]);
+
+    bool changed = counts[FILE_CACHED] != updated.records().size() ||
+                   updated.records().size() != cache.records().size();
+    cache = std::move(updated);
+    return changed;
+}
+
+/// @brief Dump the json of a `Translations file`, the invalid UTF-8 in the `Translation ID`s found in the source
+/// files is replaced with U+FFFD like the easytr::Translations::toFile().
+static std::string dumpJson(const nlohmann::json& j)
+{
+    return j.dump(4, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+/// @brief Read the json of a `Translations file`, a missing file is read as an empty json object.
+/// @return Whether the file is read.
+static bool readJsonFile(const std::string& filename, nlohmann::json& j)
+{
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs.is_open())
+    {
+        j = nlohmann::json::object();
+        return !fs::exists(filename);
+    }
+
+    j = nlohmann::json::parse(ifs, nullptr, false, true);
+    return j.is_object();
+}
+
+/// @brief Add the new `Translation ID`s with empty `Translation text` to a `Translations file`, the nested file
+/// is kept nested. (see the easytr::detail::nestJson())
+/// @return Whether the file is updated.
+static bool mergeFile(const std::set<std::string>& ids, const std::string& filename)
+{
+    nlohmann::json j;
+    if (!readJsonFile(filename, j))
+    {
+        std::fprintf(stderr, "Failed to read the file: %s\n", filename.c_str());
+        return false;
+    }
+
+    std::map<std::string, nlohmann::json> entries;
+    auto collect = [&](const std::string& tranId, const nlohmann::json& value) { entries.insert({ tranId, value }); };
+    easytr::detail::forEachJsonEntry(j, std::string(), collect);
+
+    size_t count = entries.size();
+    for (const auto& id : ids)
+        entries.insert({ id, nlohmann::json("") });
+
+    std::printf("%s: %zu new Translation IDs.\n", filename.c_str(), entries.size() - count);
+    if (entries.size() != count &&
+        !easytr::detail::writeFileAtomically(filename,
+                                             dumpJson(easytr::detail::entriesToJson(entries, easytr::detail::isNestedJson(j)))))
+    {
+        std::fprintf(stderr, "Failed to write the file: %s\n", filename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/// @brief Add the new `Translation ID`s with empty `Translation text` to the `Translations file`s.
+/// @return The number of the failed files.
+static size_t mergeIds(const std::set<std::string>& ids, const std::string& languagesFilename)
+{
+    easytr::Languages languages = easytr::Languages::fromFile(languagesFilename);
+    if (languages.empty())
+    {
+        std::fprintf(stderr, "Failed to load the Languages file: %s\n", languagesFilename.c_str());
+        return 1;
+    }
+
+    size_t failed = 0;
+    for (const auto& languageId : languages.getIds())
+    {
+        // The delta files only have the overridden `Translation ID`s, and the embedded catalogs and sources are
+        // not files that can be updated. (same as the easytr::updateTranslationsFiles())
+        if (!languages.base(languageId).empty() || languages.isEmbedded(languageId) || languages.source(languageId))
+        {
+            std::printf("%s: skipped.\n", languageId.c_str());
+            continue;
+        }
+
+        if (!languages.isManifest(languageId))
+        {
+            failed += mergeFile(ids, languages.at(languageId)) ? 0 : 1;
+            continue;
+        }
+
+        std::map<std::string, std::string> manifest = easytr::detail::readManifest(languages.at(languageId));
+        if (manifest.empty())
+        {
+            std::fprintf(stderr, "Failed to load the manifest file: %s\n", languages.at(languageId));
+            failed++;
+            continue;
+        }
+
+        std::map<std::string, std::set<std::string>> splitIds = easytr::detail::splitTranslationIds(manifest, ids);
+        for (const auto& file : manifest)
+            failed += mergeFile(splitIds[file.first], file.second) ? 0 : 1;
+    }
+    return failed;
+}
+
+/// @brief Write the `Translation ID`s with empty `Translation text` to the json file, if the file exists and
+/// is nested, it is kept nested.
+static bool writeIds(const std::set<std::string>& ids, const std::string& filename)
+{
+    nlohmann::json j;
+    bool nested = readJsonFile(filename, j) && easytr::detail::isNestedJson(j);
+
+    std::map<std::string, nlohmann::json> entries;
+    for (const auto& id : ids)
+        entries.insert({ id, nlohmann::json("") });
+    return easytr::detail::writeFileAtomically(filename, dumpJson(easytr::detail::entriesToJson(entries, nested)));
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<std::string> files = findSourceFiles(options.paths);
+
+    extractor::Cache cache;
+    if (!options.cacheFilename.empty())
+        cache = extractor::Cache::fromFile(options.cacheFilename, options.marker);
+
+    std::set<std::string> ids;
+    bool cacheChanged = extractIds(files, options, cache, ids);
+    std::printf("Found %zu Translation IDs in %zu files.\n", ids.size(), files.size());
+
+    size_t failed = 0;
+    if (!options.cacheFilename.empty() && cacheChanged && !cache.toFile(options.cacheFilename, options.marker))
+    {
+        std::fprintf(stderr, "Failed to write the file: %s\n", options.cacheFilename.c_str());
+        failed++;
+    }
+
+    if (!options.outputFilename.empty())
+    {
+        if (!writeIds(ids, options.outputFilename))
+        {
+            std::fprintf(stderr, "Failed to write the file: %s\n", options.outputFilename.c_str());
+            failed++;
+        }
+    }
+
+    if (!options.languagesFilename.empty())
+        failed += mergeIds(ids, options.languagesFilename);
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,325 @@
+// Find the `Translation ID`s that are passed to the EASYTR() in the C/C++ source files.
+
+#ifndef EASY_TRANSLATE_TEXT_ID_EXTRACTOR_SCANNER_HPP
+#define EASY_TRANSLATE_TEXT_ID_EXTRACTOR_SCANNER_HPP
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint32_t
+#include <cstring>      // memchr, memcmp
+#include <fstream>      // ifstream
+#include <iterator>     // istreambuf_iterator
+#include <string>       // string
+#include <vector>       // vector
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EXTRACTOR_SSE2
+#endif
+
+#ifdef _WIN32
+#define EXTRACTOR_NO_MMAP
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace extractor
+{
+
+// The read only content of a file, mapped into memory if possible.
+class FileView
+{
+public:
+    explicit FileView(const std::string& filename)
+    {
+    #ifndef EXTRACTOR_NO_MMAP
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* addr = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED)
+            {
+                data_ = static_cast<const char*>(addr);
+                size_ = static_cast<size_t>(st.st_size);
+                mapped_ = true;
+            }
+        }
+        ::close(fd);
+        good_ = true;
+        if (mapped_)
+            return;
+    #endif // !EXTRACTOR_NO_MMAP
+
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs.is_open())
+            return;
+        buffer_.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        good_ = true;
+    }
+
+    ~FileView()
+    {
+    #ifndef EXTRACTOR_NO_MMAP
+        if (mapped_)
+            ::munmap(const_cast<char*>(data_), size_);
+    #endif // !EXTRACTOR_NO_MMAP
+    }
+
+    FileView(const FileView&) = delete;
+
+    FileView& operator=(const FileView&) = delete;
+
+    /// @brief Check whether the file is opened.
+    bool good() const { return good_; }
+
+    const char* data() const { return data_; }
+
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    bool good_ = false;
+    std::string buffer_;
+};
+
+/// @brief Find the first occurrence of the `marker` in [begin, end), if not found return nullptr.
+/// @note The SSE2 path compares the first and the last character of the `marker` for 16 positions at once,
+/// and only verifies the whole `marker` on the positions that both are matched.
+inline const char* findMarker(const char* begin, const char* end, const std::string& marker)
+{
+    const size_t len = marker.size();
+    if (len == 0 || static_cast<size_t>(end - begin) < len)
+        return nullptr;
+
+    const char* last = end - len; // The last possible position.
+    const char* p = begin;
+
+#ifdef EXTRACTOR_SSE2
+    const __m128i first = _mm_set1_epi8(marker.front());
+    const __m128i tail = _mm_set1_epi8(marker.back());
+    for (; p + 16 <= last + 1; p += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + len - 1));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, tail))));
+        while (mask != 0)
+        {
+            unsigned bit = 0;
+            while (((mask >> bit) & 1) == 0)
+                ++bit;
+            if (std::memcmp(p + bit, marker.data(), len) == 0)
+                return p + bit;
+            mask &= mask - 1;
+        }
+    }
+#endif // EXTRACTOR_SSE2
+
+    while (p <= last)
+    {
+        p = static_cast<const char*>(std::memchr(p, marker.front(), static_cast<size_t>(last - p) + 1));
+        if (!p)
+            return nullptr;
+        if (std::memcmp(p, marker.data(), len) == 0)
+            return p;
+        ++p;
+    }
+
+    return nullptr;
+}
+
+inline bool isIdentifierChar(char ch)
+{
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_';
+}
+
+inline void appendUtf8(std::string& str, uint32_t cp)
+{
+    if (cp < 0x80)
+    {
+        str += static_cast<char>(cp);
+    }
+    else if (cp < 0x800)
+    {
+        str += static_cast<char>(0xC0 | (cp >> 6));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000)
+    {
+        str += static_cast<char>(0xE0 | (cp >> 12));
+        str += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    else
+    {
+        str += static_cast<char>(0xF0 | (cp >> 18));
+        str += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        str += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        str += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+inline int hexValue(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+        return ch - 'A' + 10;
+    return -1;
+}
+
+inline const char* skipSpaces(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+        ++p;
+    return p;
+}
+
+/// @brief Parse a string literal (ordinary, u8 or raw) at `p` and append its value to the `out`.
+/// @return The position after the literal, or nullptr if `p` is not a string literal.
+inline const char* parseStringLiteral(const char* p, const char* end, std::string& out)
+{
+    if (end - p >= 2 && p[0] == 'u' && p[1] == '8')
+        p += 2;
+
+    bool raw = p < end && *p == 'R';
+    if (raw)
+        ++p;
+    if (p >= end || *p != '"')
+        return nullptr;
+    ++p;
+
+    if (raw)
+    {
+        // R"delimiter( ... )delimiter"
+        const char* open = p;
+        while (p < end && *p != '(' && p - open <= 16)
+            ++p;
+        if (p >= end || *p != '(')
+            return nullptr;
+
+        std::string close = ")" + std::string(open, p) + "\"";
+        const char* body = p + 1;
+        const char* found = findMarker(body, end, close);
+        if (!found)
+            return nullptr;
+        out.append(body, found);
+        return found + close.size();
+    }
+
+    while (p < end && *p != '"')
+    {
+        if (*p == '\n')
+            return nullptr;
+        if (*p != '\\')
+        {
+            out += *p++;
+            continue;
+        }
+
+        if (++p >= end)
+            return nullptr;
+        char ch = *p++;
+        switch (ch)
+        {
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'a': out += '\a'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'v': out += '\v'; break;
+            case '\n': break; // Line continuation.
+            case 'x':
+            {
+                uint32_t value = 0;
+                while (p < end && hexValue(*p) >= 0)
+                    value = value * 16 + static_cast<uint32_t>(hexValue(*p++));
+                out += static_cast<char>(value);
+                break;
+            }
+            case 'u':
+            case 'U':
+            {
+                int digits = ch == 'u' ? 4 : 8;
+                uint32_t cp = 0;
+                for (int i = 0; i < digits && p < end && hexValue(*p) >= 0; ++i)
+                    cp = cp * 16 + static_cast<uint32_t>(hexValue(*p++));
+                appendUtf8(out, cp);
+                break;
+            }
+            default:
+                if (ch >= '0' && ch <= '7')
+                {
+                    uint32_t value = static_cast<uint32_t>(ch - '0');
+                    for (int i = 0; i < 2 && p < end && *p >= '0' && *p <= '7'; ++i)
+                        value = value * 8 + static_cast<uint32_t>(*p++ - '0');
+                    out += static_cast<char>(value);
+                }
+                else
+                {
+                    out += ch; // \" \' \\ \?
+                }
+                break;
+        }
+    }
+
+    if (p >= end)
+        return nullptr;
+    return p + 1;
+}
+
+/// @brief Append the `Translation ID`s of all `marker`("...") in the content to the `ids`.
+/// @note - Several calls on one line, escaped characters, raw strings and adjacent string literals
+/// (e.g. EASYTR("App." "Title")) are supported.
+/// @note - The call whose argument is not only string literals (e.g. EASYTR(id)) is ignored.
+inline void scan(const char* data, size_t size, const std::string& marker, std::vector<std::string>& ids)
+{
+    const char* end = data + size;
+    for (const char* p = findMarker(data, end, marker); p; p = findMarker(p, end, marker))
+    {
+        const char* start = p;
+        p += marker.size();
+
+        // Skip the identifiers that only end with the `marker`, like MY_EASYTR.
+        if (start != data && isIdentifierChar(start[-1]))
+            continue;
+
+        // The variants of the `marker` (like EASYTR_FMT) take the `Translation ID` as the first argument too.
+        bool variant = p < end && *p == '_';
+        if (variant)
+            while (p < end && isIdentifierChar(*p))
+                ++p;
+
+        p = skipSpaces(p, end);
+        if (p >= end || *p != '(')
+            continue;
+        p = skipSpaces(p + 1, end);
+
+        std::string id;
+        const char* next = parseStringLiteral(p, end, id);
+        if (!next)
+            continue;
+        for (p = skipSpaces(next, end); (next = parseStringLiteral(p, end, id)) != nullptr; p = skipSpaces(next, end))
+        {}
+
+        if (p < end && (*p == ')' || (variant && *p == ',')))
+            ids.push_back(std::move(id));
+    }
+}
+
+} // namespace extractor
+
+#endif // !EASY_TRANSLATE_TEXT_ID_EXTRACTOR_SCANNER_HPP